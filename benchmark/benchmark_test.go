@@ -0,0 +1,201 @@
+package benchmark
+
+import (
+	"crypto/cipher"
+	"encoding/json"
+	"flag"
+	"fmt"
+	"io/ioutil"
+	"regexp"
+	"runtime"
+	"strconv"
+	"strings"
+	"testing"
+
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/suites"
+)
+
+var (
+	benchSuites = flag.String("benchmark.suites", "Ed25519,P256,bn256.G1,bn256.G2", "suites to benchmark, by name")
+	benchN      = flag.String("benchmark.n", "16,64", "committee and batch sizes")
+	benchK      = flag.String("benchmark.k", "16,128", "numbers of pairs to shuffle")
+	benchJSON   = flag.String("benchmark.json", "", "write the results of TestReport to this file")
+	benchMatch  = flag.String("benchmark.match", "", "only report the cases whose name matches this regular expression")
+)
+
+// benchCase is one operation of a protocol, on a suite and at a size.
+type benchCase struct {
+	suite string
+	op    string
+	// n is the size of the committee, the batch or the shuffle, or 0 if the
+	// operation does not depend on one.
+	n   int
+	run func(b *testing.B)
+}
+
+// name returns the name of c below its protocol, which is also the name of
+// its sub-benchmark.
+func (c *benchCase) name() string {
+	name := c.suite + "/" + c.op
+	if c.n > 0 {
+		name += "/n=" + strconv.Itoa(c.n)
+	}
+	return name
+}
+
+// protocols lists the cases of every protocol, in the order of the report.
+var protocols = []struct {
+	name  string
+	cases func() []*benchCase
+}{
+	{"Schnorr", schnorrCases},
+	{"EdDSA", eddsaCases},
+	{"BLS", blsCases},
+	{"TBLS", tblsCases},
+	{"CoSi", cosiCases},
+	{"DKGPedersen", pedersenCases},
+	{"DKGRabin", rabinCases},
+	{"Shuffle", shuffleCases},
+}
+
+func runCases(b *testing.B, cases []*benchCase) {
+	for _, c := range cases {
+		c := c
+		b.Run(c.name(), func(b *testing.B) {
+			b.ReportAllocs()
+			c.run(b)
+		})
+	}
+}
+
+func BenchmarkSchnorr(b *testing.B)     { runCases(b, schnorrCases()) }
+func BenchmarkEdDSA(b *testing.B)       { runCases(b, eddsaCases()) }
+func BenchmarkBLS(b *testing.B)         { runCases(b, blsCases()) }
+func BenchmarkTBLS(b *testing.B)        { runCases(b, tblsCases()) }
+func BenchmarkCoSi(b *testing.B)        { runCases(b, cosiCases()) }
+func BenchmarkDKGPedersen(b *testing.B) { runCases(b, pedersenCases()) }
+func BenchmarkDKGRabin(b *testing.B)    { runCases(b, rabinCases()) }
+func BenchmarkShuffle(b *testing.B)     { runCases(b, shuffleCases()) }
+
+// record is the result of a case in the JSON report.
+type record struct {
+	Name        string `json:"name"`
+	Protocol    string `json:"protocol"`
+	Suite       string `json:"suite"`
+	Op          string `json:"op"`
+	N           int    `json:"n,omitempty"`
+	Iterations  int    `json:"iterations"`
+	NsPerOp     int64  `json:"ns_per_op"`
+	BytesPerOp  int64  `json:"bytes_per_op"`
+	AllocsPerOp int64  `json:"allocs_per_op"`
+}
+
+type report struct {
+	GoVersion  string    `json:"go_version"`
+	GOOS       string    `json:"goos"`
+	GOARCH     string    `json:"goarch"`
+	GOMAXPROCS int       `json:"gomaxprocs"`
+	Results    []*record `json:"results"`
+}
+
+// TestReport runs every case, like the benchmarks do, and writes the results
+// to the file given by -benchmark.json. It is skipped without that flag.
+func TestReport(t *testing.T) {
+	if *benchJSON == "" {
+		t.Skip("no -benchmark.json file to report to")
+	}
+	match, err := regexp.Compile(*benchMatch)
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	r := &report{
+		GoVersion:  runtime.Version(),
+		GOOS:       runtime.GOOS,
+		GOARCH:     runtime.GOARCH,
+		GOMAXPROCS: runtime.GOMAXPROCS(0),
+	}
+	for _, p := range protocols {
+		for _, c := range p.cases() {
+			c := c
+			name := p.name + "/" + c.name()
+			if !match.MatchString(name) {
+				continue
+			}
+			res := testing.Benchmark(func(b *testing.B) {
+				b.ReportAllocs()
+				c.run(b)
+			})
+			if res.N == 0 {
+				t.Fatalf("%s failed", name)
+			}
+			t.Logf("%s\t%s\t%s", name, res.String(), res.MemString())
+			r.Results = append(r.Results, &record{
+				Name:        name,
+				Protocol:    p.name,
+				Suite:       c.suite,
+				Op:          c.op,
+				N:           c.n,
+				Iterations:  res.N,
+				NsPerOp:     res.NsPerOp(),
+				BytesPerOp:  res.AllocedBytesPerOp(),
+				AllocsPerOp: res.AllocsPerOp(),
+			})
+		}
+	}
+
+	buf, err := json.MarshalIndent(r, "", "\t")
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := ioutil.WriteFile(*benchJSON, append(buf, '\n'), 0644); err != nil {
+		t.Fatal(err)
+	}
+}
+
+// benchmarkSuites returns the suites selected by -benchmark.suites.
+func benchmarkSuites() []suites.Suite {
+	var list []suites.Suite
+	for _, name := range strings.Split(*benchSuites, ",") {
+		if name = strings.TrimSpace(name); name != "" {
+			list = append(list, suites.MustFind(name))
+		}
+	}
+	return list
+}
+
+// sizes parses a comma-separated list of sizes.
+func sizes(list string) []int {
+	var ns []int
+	for _, s := range strings.Split(list, ",") {
+		if s = strings.TrimSpace(s); s == "" {
+			continue
+		}
+		n, err := strconv.Atoi(s)
+		if err != nil || n < 2 {
+			panic(fmt.Sprintf("benchmark: invalid size %q", s))
+		}
+		ns = append(ns, n)
+	}
+	return ns
+}
+
+func keyPairs(g kyber.Group, n int, rand cipher.Stream) ([]kyber.Scalar, []kyber.Point) {
+	privates := make([]kyber.Scalar, n)
+	publics := make([]kyber.Point, n)
+	for i := range privates {
+		privates[i] = g.Scalar().Pick(rand)
+		publics[i] = g.Point().Mul(privates[i], nil)
+	}
+	return privates, publics
+}
+
+// messages returns n distinct messages.
+func messages(n int) [][]byte {
+	msgs := make([][]byte, n)
+	for i := range msgs {
+		msgs[i] = []byte("benchmark message " + strconv.Itoa(i))
+	}
+	return msgs
+}
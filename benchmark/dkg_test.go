@@ -0,0 +1,313 @@
+package benchmark
+
+import (
+	"testing"
+
+	"go.dedis.ch/kyber/v3"
+	pedersen "go.dedis.ch/kyber/v3/share/dkg/pedersen"
+	rabin "go.dedis.ch/kyber/v3/share/dkg/rabin"
+	vss "go.dedis.ch/kyber/v3/share/vss/pedersen"
+	"go.dedis.ch/kyber/v3/suites"
+)
+
+// maxRunN is the largest committee whose whole DKG is simulated: every node
+// processes the n-1 responses of every deal, so the run is cubic in n.
+const maxRunN = 32
+
+// The DKG cases measure node 0 of a committee of n, with the threshold that
+// vss recommends: the dealing of its deals, the processing of the deals it
+// receives, and the processing of the responses to the deals of the others.
+// The node is created anew for each iteration, outside of the timer. The
+// deals and responses come from one exchange between all the nodes, which is
+// shared by the cases of a suite and size. Run covers the whole protocol for
+// all the nodes, as a single machine would simulate it.
+
+func pedersenCases() []*benchCase {
+	var cases []*benchCase
+	for _, s := range benchmarkSuites() {
+		for _, n := range sizes(*benchN) {
+			s, n, t := s, n, vss.MinimumT(n)
+			privates, publics := keyPairs(s, n, s.RandomStream())
+			newNode := func(b *testing.B, i int) *pedersen.DistKeyGenerator {
+				d, err := pedersen.NewDistKeyGenerator(s, privates[i], publics, t)
+				if err != nil {
+					b.Fatal(err)
+				}
+				return d
+			}
+			var (
+				deals []*pedersen.Deal
+				resps []*pedersen.Response
+			)
+			setup := func(b *testing.B) {
+				if deals == nil {
+					deals, resps = pedersenExchange(b, s, privates, publics, t, false)
+				}
+			}
+			add := func(op string, run func(b *testing.B)) {
+				cases = append(cases, &benchCase{suite: s.String(), op: op, n: n, run: run})
+			}
+
+			add("Deal", func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					if _, err := newNode(b, 0).Deals(); err != nil {
+						b.Fatal(err)
+					}
+				}
+			})
+			add("ProcessDeals", func(b *testing.B) {
+				setup(b)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					b.StopTimer()
+					d := newNode(b, 0)
+					b.StartTimer()
+					for _, deal := range deals {
+						if _, err := d.ProcessDeal(deal); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}
+			})
+			add("ProcessResponses", func(b *testing.B) {
+				setup(b)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					b.StopTimer()
+					d := newNode(b, 0)
+					for _, deal := range deals {
+						if _, err := d.ProcessDeal(deal); err != nil {
+							b.Fatal(err)
+						}
+					}
+					b.StartTimer()
+					for _, resp := range resps {
+						if j, err := d.ProcessResponse(resp); err != nil || j != nil {
+							b.Fatal(err)
+						}
+					}
+				}
+			})
+			if n <= maxRunN {
+				add("Run", func(b *testing.B) {
+					for i := 0; i < b.N; i++ {
+						pedersenExchange(b, s, privates, publics, t, true)
+					}
+				})
+			}
+		}
+	}
+	return cases
+}
+
+// pedersenExchange deals the shares of every node to the others. It returns
+// the deals to node 0 and the responses that node 0 processes, those of the
+// other nodes to the deals of the other dealers. If finish is true, it also
+// broadcasts all the responses and computes the share of every node.
+func pedersenExchange(b *testing.B, s suites.Suite, privates []kyber.Scalar, publics []kyber.Point, t int, finish bool) ([]*pedersen.Deal, []*pedersen.Response) {
+	dkgs := make([]*pedersen.DistKeyGenerator, len(privates))
+	for i := range dkgs {
+		var err error
+		if dkgs[i], err = pedersen.NewDistKeyGenerator(s, privates[i], publics, t); err != nil {
+			b.Fatal(err)
+		}
+	}
+	var (
+		deals []*pedersen.Deal
+		all   []*pedersen.Response
+		resps []*pedersen.Response
+	)
+	for _, d := range dkgs {
+		ds, err := d.Deals()
+		if err != nil {
+			b.Fatal(err)
+		}
+		for i, deal := range ds {
+			if i == 0 {
+				deals = append(deals, deal)
+			}
+			resp, err := dkgs[i].ProcessDeal(deal)
+			if err != nil {
+				b.Fatal(err)
+			}
+			if resp.Response.Status != vss.StatusApproval {
+				b.Fatalf("node %d rejected the deal of %d", i, deal.Index)
+			}
+			all = append(all, resp)
+			if resp.Index != 0 && resp.Response.Index != 0 {
+				resps = append(resps, resp)
+			}
+		}
+	}
+	if !finish {
+		return deals, resps
+	}
+
+	for _, resp := range all {
+		for i, d := range dkgs {
+			if resp.Response.Index == uint32(i) {
+				continue
+			}
+			if j, err := d.ProcessResponse(resp); err != nil || j != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+	for _, d := range dkgs {
+		if _, err := d.DistKeyShare(); err != nil {
+			b.Fatal(err)
+		}
+	}
+	return deals, resps
+}
+
+func rabinCases() []*benchCase {
+	var cases []*benchCase
+	for _, s := range benchmarkSuites() {
+		for _, n := range sizes(*benchN) {
+			s, n, t := s, n, vss.MinimumT(n)
+			privates, publics := keyPairs(s, n, s.RandomStream())
+			newNode := func(b *testing.B, i int) *rabin.DistKeyGenerator {
+				d, err := rabin.NewDistKeyGenerator(s, privates[i], publics, t)
+				if err != nil {
+					b.Fatal(err)
+				}
+				return d
+			}
+			var (
+				deals []*rabin.Deal
+				resps []*rabin.Response
+			)
+			setup := func(b *testing.B) {
+				if deals == nil {
+					deals, resps = rabinExchange(b, s, privates, publics, t, false)
+				}
+			}
+			add := func(op string, run func(b *testing.B)) {
+				cases = append(cases, &benchCase{suite: s.String(), op: op, n: n, run: run})
+			}
+
+			add("Deal", func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					if _, err := newNode(b, 0).Deals(); err != nil {
+						b.Fatal(err)
+					}
+				}
+			})
+			add("ProcessDeals", func(b *testing.B) {
+				setup(b)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					b.StopTimer()
+					d := newNode(b, 0)
+					b.StartTimer()
+					for _, deal := range deals {
+						if _, err := d.ProcessDeal(deal); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}
+			})
+			add("ProcessResponses", func(b *testing.B) {
+				setup(b)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					b.StopTimer()
+					d := newNode(b, 0)
+					for _, deal := range deals {
+						if _, err := d.ProcessDeal(deal); err != nil {
+							b.Fatal(err)
+						}
+					}
+					b.StartTimer()
+					for _, resp := range resps {
+						if j, err := d.ProcessResponse(resp); err != nil || j != nil {
+							b.Fatal(err)
+						}
+					}
+				}
+			})
+			if n <= maxRunN {
+				add("Run", func(b *testing.B) {
+					for i := 0; i < b.N; i++ {
+						rabinExchange(b, s, privates, publics, t, true)
+					}
+				})
+			}
+		}
+	}
+	return cases
+}
+
+// rabinExchange is pedersenExchange for the DKG of rabin, whose nodes also
+// broadcast their secret commitments before computing their shares.
+func rabinExchange(b *testing.B, s suites.Suite, privates []kyber.Scalar, publics []kyber.Point, t int, finish bool) ([]*rabin.Deal, []*rabin.Response) {
+	dkgs := make([]*rabin.DistKeyGenerator, len(privates))
+	for i := range dkgs {
+		var err error
+		if dkgs[i], err = rabin.NewDistKeyGenerator(s, privates[i], publics, t); err != nil {
+			b.Fatal(err)
+		}
+	}
+	var (
+		deals []*rabin.Deal
+		all   []*rabin.Response
+		resps []*rabin.Response
+	)
+	for _, d := range dkgs {
+		ds, err := d.Deals()
+		if err != nil {
+			b.Fatal(err)
+		}
+		for i, deal := range ds {
+			if i == 0 {
+				deals = append(deals, deal)
+			}
+			resp, err := dkgs[i].ProcessDeal(deal)
+			if err != nil {
+				b.Fatal(err)
+			}
+			if !resp.Response.Approved {
+				b.Fatalf("node %d rejected the deal of %d", i, deal.Index)
+			}
+			all = append(all, resp)
+			if resp.Index != 0 && resp.Response.Index != 0 {
+				resps = append(resps, resp)
+			}
+		}
+	}
+	if !finish {
+		return deals, resps
+	}
+
+	for _, resp := range all {
+		for i, d := range dkgs {
+			if resp.Response.Index == uint32(i) {
+				continue
+			}
+			if j, err := d.ProcessResponse(resp); err != nil || j != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+	for i, d := range dkgs {
+		sc, err := d.SecretCommits()
+		if err != nil {
+			b.Fatal(err)
+		}
+		for j, d2 := range dkgs {
+			if i == j {
+				continue
+			}
+			if cc, err := d2.ProcessSecretCommits(sc); err != nil || cc != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+	for _, d := range dkgs {
+		if _, err := d.DistKeyShare(); err != nil {
+			b.Fatal(err)
+		}
+	}
+	return deals, resps
+}
@@ -0,0 +1,23 @@
+// Package benchmark holds the protocol-level benchmarks of kyber: signatures,
+// collective signatures, distributed key generation and verifiable shuffles,
+// run on every suite they apply to and at several committee sizes. It contains
+// no code besides its tests.
+//
+// The benchmarks print the usual output of go test, which benchstat reads:
+//
+//	go test ./benchmark -run XXX -bench . -benchmark.n 16,64,256 > new.txt
+//	benchstat old.txt new.txt
+//
+// The same cases are written as JSON, one record per case with its protocol,
+// suite, operation and size, by
+//
+//	go test ./benchmark -run TestReport -benchmark.json report.json
+//
+// The flags -benchmark.suites, -benchmark.n and -benchmark.k select the
+// suites, the committee or batch sizes and the shuffle sizes, and
+// -benchmark.match restricts the JSON report to the cases whose name matches a
+// regular expression. The DKG cases measure the work of a single node, which
+// is what grows with the committee. They also run the whole protocol, for all
+// the nodes, up to n = 32. Above that, the simulated run is cubic in n and
+// takes too long.
+package benchmark
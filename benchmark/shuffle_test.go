@@ -0,0 +1,69 @@
+package benchmark
+
+import (
+	"testing"
+
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/proof"
+	"go.dedis.ch/kyber/v3/shuffle"
+	"go.dedis.ch/kyber/v3/suites"
+)
+
+// shuffleCases prove and verify the shuffle of k ElGamal ciphertexts, as a
+// mix server and its auditors do.
+func shuffleCases() []*benchCase {
+	var cases []*benchCase
+	for _, s := range benchmarkSuites() {
+		if !canShuffle(s) {
+			continue
+		}
+		for _, k := range sizes(*benchK) {
+			s, k := s, k
+			rand := s.RandomStream()
+			H := s.Point().Pick(rand)
+			X := make([]kyber.Point, k)
+			Y := make([]kyber.Point, k)
+			for i := range X {
+				r := s.Scalar().Pick(rand)
+				X[i] = s.Point().Mul(r, nil)
+				Y[i] = s.Point().Mul(r, H)
+				Y[i].Add(Y[i], s.Point().Pick(rand))
+			}
+			cases = append(cases,
+				&benchCase{suite: s.String(), op: "Prove", n: k, run: func(b *testing.B) {
+					for i := 0; i < b.N; i++ {
+						_, _, prover := shuffle.Shuffle(s, nil, H, X, Y, rand)
+						if _, err := proof.HashProve(s, "PairShuffle", prover); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}},
+				&benchCase{suite: s.String(), op: "Verify", n: k, run: func(b *testing.B) {
+					Xbar, Ybar, prover := shuffle.Shuffle(s, nil, H, X, Y, rand)
+					prf, err := proof.HashProve(s, "PairShuffle", prover)
+					if err != nil {
+						b.Fatal(err)
+					}
+					b.ResetTimer()
+					for i := 0; i < b.N; i++ {
+						verifier := shuffle.Verifier(s, nil, H, X, Y, Xbar, Ybar)
+						if err := proof.HashVerify(s, "PairShuffle", verifier, prf); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}})
+		}
+	}
+	return cases
+}
+
+// canShuffle reports whether s decodes random strings of bytes to scalars,
+// as the proof context of a shuffle expects when it reads its secrets from a
+// random stream. The probe is at least 15/16 of 2^(8l) for l bytes in either
+// byte order, so a group that rejects it, such as bn256, rejects at least one
+// string in 16 and fails proofs at random.
+func canShuffle(s suites.Suite) bool {
+	buf := make([]byte, s.ScalarLen())
+	buf[0], buf[len(buf)-1] = 0xf0, 0xf0
+	return s.Scalar().UnmarshalBinary(buf) == nil
+}
@@ -0,0 +1,363 @@
+package benchmark
+
+import (
+	"testing"
+
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/pairing/bn256"
+	"go.dedis.ch/kyber/v3/share"
+	"go.dedis.ch/kyber/v3/sign/bls"
+	"go.dedis.ch/kyber/v3/sign/cosi"
+	"go.dedis.ch/kyber/v3/sign/eddsa"
+	"go.dedis.ch/kyber/v3/sign/schnorr"
+	"go.dedis.ch/kyber/v3/sign/tbls"
+	"go.dedis.ch/kyber/v3/suites"
+	"go.dedis.ch/kyber/v3/util/random"
+)
+
+var msg = []byte("benchmark message")
+
+func schnorrCases() []*benchCase {
+	var cases []*benchCase
+	for _, s := range benchmarkSuites() {
+		s := s
+		private, public := keyPairs(s, 1, s.RandomStream())
+		sig, err := schnorr.Sign(s, private[0], msg)
+		if err != nil {
+			panic(err)
+		}
+		cases = append(cases,
+			&benchCase{suite: s.String(), op: "Sign", run: func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					if _, err := schnorr.Sign(s, private[0], msg); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			&benchCase{suite: s.String(), op: "Verify", run: func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					if err := schnorr.Verify(s, public[0], msg, sig); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+		for _, n := range sizes(*benchN) {
+			n := n
+			cases = append(cases, &benchCase{suite: s.String(), op: "BatchVerify", n: n, run: func(b *testing.B) {
+				privates, publics := keyPairs(s, n, s.RandomStream())
+				msgs := messages(n)
+				sigs := make([][]byte, n)
+				for i := range sigs {
+					var err error
+					if sigs[i], err = schnorr.Sign(s, privates[i], msgs[i]); err != nil {
+						b.Fatal(err)
+					}
+				}
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					if _, err := schnorr.BatchVerify(s, publics, msgs, sigs); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+		}
+	}
+	return cases
+}
+
+// eddsaCases only run on Ed25519, the one suite of EdDSA.
+func eddsaCases() []*benchCase {
+	name := suites.MustFind("Ed25519").String()
+	ed := eddsa.NewEdDSA(random.New())
+	sig, err := ed.Sign(msg)
+	if err != nil {
+		panic(err)
+	}
+	cases := []*benchCase{
+		{suite: name, op: "Sign", run: func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				if _, err := ed.Sign(msg); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}},
+		{suite: name, op: "Verify", run: func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				if err := eddsa.Verify(ed.Public, msg, sig); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}},
+	}
+	for _, n := range sizes(*benchN) {
+		n := n
+		cases = append(cases, &benchCase{suite: name, op: "BatchVerify", n: n, run: func(b *testing.B) {
+			publics := make([]kyber.Point, n)
+			msgs := messages(n)
+			sigs := make([][]byte, n)
+			for i := range sigs {
+				ed := eddsa.NewEdDSA(random.New())
+				publics[i] = ed.Public
+				var err error
+				if sigs[i], err = ed.Sign(msgs[i]); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := eddsa.BatchVerify(publics, msgs, sigs); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}})
+	}
+	return cases
+}
+
+// blsCases run on bn256, with signatures in G1 and public keys in G2.
+func blsCases() []*benchCase {
+	suite := bn256.NewSuite()
+	const name = "bn256"
+	private, public := bls.NewKeyPair(suite, random.New())
+	sig, err := bls.Sign(suite, private, msg)
+	if err != nil {
+		panic(err)
+	}
+	cases := []*benchCase{
+		{suite: name, op: "Sign", run: func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				if _, err := bls.Sign(suite, private, msg); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}},
+		{suite: name, op: "Verify", run: func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				if err := bls.Verify(suite, public, msg, sig); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}},
+	}
+	for _, n := range sizes(*benchN) {
+		n := n
+		// setup signs the same message and n distinct ones with n keys.
+		setup := func(b *testing.B) (publics []kyber.Point, msgs, same, sigs [][]byte) {
+			publics = make([]kyber.Point, n)
+			msgs = messages(n)
+			same = make([][]byte, n)
+			sigs = make([][]byte, n)
+			for i := range publics {
+				var private kyber.Scalar
+				private, publics[i] = bls.NewKeyPair(suite, random.New())
+				var err error
+				if same[i], err = bls.Sign(suite, private, msg); err != nil {
+					b.Fatal(err)
+				}
+				if sigs[i], err = bls.Sign(suite, private, msgs[i]); err != nil {
+					b.Fatal(err)
+				}
+			}
+			return
+		}
+		cases = append(cases,
+			&benchCase{suite: name, op: "AggregateVerify", n: n, run: func(b *testing.B) {
+				publics, _, same, _ := setup(b)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					agg, err := bls.AggregateSignatures(suite, same...)
+					if err != nil {
+						b.Fatal(err)
+					}
+					if err := bls.Verify(suite, bls.AggregatePublicKeys(suite, publics...), msg, agg); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			&benchCase{suite: name, op: "BatchVerify", n: n, run: func(b *testing.B) {
+				publics, msgs, _, sigs := setup(b)
+				agg, err := bls.AggregateSignatures(suite, sigs...)
+				if err != nil {
+					b.Fatal(err)
+				}
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					if err := bls.BatchVerify(suite, publics, msgs, agg); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			&benchCase{suite: name, op: "BatchVerifySignatures", n: n, run: func(b *testing.B) {
+				publics, msgs, _, sigs := setup(b)
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					if err := bls.BatchVerifySignatures(suite, publics, msgs, sigs); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+	}
+	return cases
+}
+
+// tblsCases share the key of a committee of n with a threshold of a
+// majority, as the tests of tbls do.
+func tblsCases() []*benchCase {
+	suite := bn256.NewSuite()
+	const name = "bn256"
+	var cases []*benchCase
+	for _, n := range sizes(*benchN) {
+		n, t := n, n/2+1
+		priPoly := share.NewPriPoly(suite.G2(), t, nil, random.New())
+		pubPoly := priPoly.Commit(suite.G2().Point().Base())
+		shares := priPoly.Shares(n)
+		sig, err := tbls.Sign(suite, shares[0], msg)
+		if err != nil {
+			panic(err)
+		}
+		cases = append(cases,
+			&benchCase{suite: name, op: "Sign", n: n, run: func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					if _, err := tbls.Sign(suite, shares[0], msg); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			&benchCase{suite: name, op: "Verify", n: n, run: func(b *testing.B) {
+				for i := 0; i < b.N; i++ {
+					if err := tbls.Verify(suite, pubPoly, msg, sig); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}},
+			&benchCase{suite: name, op: "Recover", n: n, run: func(b *testing.B) {
+				sigs := make([][]byte, t)
+				for i := range sigs {
+					var err error
+					if sigs[i], err = tbls.Sign(suite, shares[i], msg); err != nil {
+						b.Fatal(err)
+					}
+				}
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					if _, err := tbls.Recover(suite, pubPoly, msg, sigs, t, n); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}})
+	}
+	return cases
+}
+
+// cosiCases measure the leader of a round with n cosigners, who aggregates
+// the commitments and responses into the signature, and its verifiers.
+func cosiCases() []*benchCase {
+	var cases []*benchCase
+	for _, s := range benchmarkSuites() {
+		for _, n := range sizes(*benchN) {
+			s, n := s, n
+			var (
+				publics     []kyber.Point
+				commitments []kyber.Point
+				masks       [][]byte
+				responses   []kyber.Scalar
+				sig         []byte
+			)
+			// setup runs a round once, for all the cases of s and n.
+			setup := func(b *testing.B) {
+				if sig != nil {
+					return
+				}
+				var privates []kyber.Scalar
+				privates, publics = keyPairs(s, n, s.RandomStream())
+				secrets := make([]kyber.Scalar, n)
+				commitments = make([]kyber.Point, n)
+				masks = make([][]byte, n)
+				for i := range publics {
+					secrets[i], commitments[i] = cosi.Commit(s)
+					mask, err := cosi.NewMask(s, publics, publics[i])
+					if err != nil {
+						b.Fatal(err)
+					}
+					masks[i] = mask.Mask()
+				}
+				V, aggMask, err := cosi.AggregateCommitments(s, commitments, masks)
+				if err != nil {
+					b.Fatal(err)
+				}
+				mask, err := cosi.NewMask(s, publics, nil)
+				if err != nil {
+					b.Fatal(err)
+				}
+				if err := mask.SetMask(aggMask); err != nil {
+					b.Fatal(err)
+				}
+				c, err := cosi.Challenge(s, V, mask.AggregatePublic, msg)
+				if err != nil {
+					b.Fatal(err)
+				}
+				responses = make([]kyber.Scalar, n)
+				for i := range responses {
+					if responses[i], err = cosi.Response(s, privates[i], secrets[i], c); err != nil {
+						b.Fatal(err)
+					}
+				}
+				r, err := cosi.AggregateResponses(s, responses)
+				if err != nil {
+					b.Fatal(err)
+				}
+				if sig, err = cosi.Sign(s, V, r, mask); err != nil {
+					b.Fatal(err)
+				}
+			}
+			cases = append(cases,
+				&benchCase{suite: s.String(), op: "Aggregate", n: n, run: func(b *testing.B) {
+					setup(b)
+					mask, err := cosi.NewMask(s, publics, nil)
+					if err != nil {
+						b.Fatal(err)
+					}
+					b.ResetTimer()
+					for i := 0; i < b.N; i++ {
+						V, aggMask, err := cosi.AggregateCommitments(s, commitments, masks)
+						if err != nil {
+							b.Fatal(err)
+						}
+						if err := mask.SetMask(aggMask); err != nil {
+							b.Fatal(err)
+						}
+						r, err := cosi.AggregateResponses(s, responses)
+						if err != nil {
+							b.Fatal(err)
+						}
+						if _, err := cosi.Sign(s, V, r, mask); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}},
+				&benchCase{suite: s.String(), op: "Verify", n: n, run: func(b *testing.B) {
+					setup(b)
+					b.ResetTimer()
+					for i := 0; i < b.N; i++ {
+						if err := cosi.Verify(s, publics, msg, sig, nil); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}},
+				&benchCase{suite: s.String(), op: "VerifyMask", n: n, run: func(b *testing.B) {
+					setup(b)
+					mask, err := cosi.NewMask(s, publics, nil)
+					if err != nil {
+						b.Fatal(err)
+					}
+					b.ResetTimer()
+					for i := 0; i < b.N; i++ {
+						if err := cosi.VerifyMask(s, mask, msg, sig, nil); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}})
+		}
+	}
+	return cases
+}
@@ -31,6 +31,15 @@ type Marshaling interface {
 	UnmarshalFrom(r io.Reader) (int, error)
 }
 
+// BinaryAppender is an optional interface of Marshaling objects that can
+// append their MarshalBinary encoding to a caller-supplied buffer, so that
+// encoding many of them does not need an allocation for each one.
+type BinaryAppender interface {
+	// AppendBinary appends the MarshalBinary encoding of the object to b
+	// and returns the extended buffer.
+	AppendBinary(b []byte) ([]byte, error)
+}
+
 // Encoding represents an abstract interface to an encoding/decoding that can be
 // used to marshal/unmarshal objects to and from streams. Different Encodings
 // will have different constraints, of course. Two implementations are
@@ -124,6 +124,23 @@ type AllowsVarTime interface {
 	AllowVarTime(bool)
 }
 
+// MultiScalarMultiplier is an optional interface for Points that can compute
+// sums of products of points and scalars faster than with one Mul per term.
+// MultiScalarMul sets the receiver to scalars[0]·points[0] + ... +
+// scalars[n-1]·points[n-1] and returns it. A nil point stands for the
+// standard base point, as in Mul. Implementations may take variable time,
+// so only use it on public Scalars and Points.
+type MultiScalarMultiplier interface {
+	MultiScalarMul(scalars []Scalar, points []Point) Point
+}
+
+// Cofactored is an optional interface for Groups whose order is a small
+// cofactor times a large prime, such as edwards25519, so that their points
+// may have a component of small order. Cofactor returns the cofactor.
+type Cofactored interface {
+	Cofactor() int64
+}
+
 // Group interface represents a mathematical group
 // usable for Diffie-Hellman key exchange, ElGamal encryption,
 // and the related body of public-key cryptographic algorithms
@@ -6,10 +6,12 @@ import (
 	"crypto/cipher"
 	"io"
 	"math/big"
+	"time"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
 	"go.dedis.ch/kyber/v3/group/mod"
+	"go.dedis.ch/kyber/v3/util/metrics"
 )
 
 type basicPoint struct {
@@ -169,6 +171,9 @@ func (P *basicPoint) Mul(s kyber.Scalar, G kyber.Point) kyber.Point {
 	if G == nil {
 		return P.Base().Mul(s, P)
 	}
+	if metrics.Enabled {
+		defer mulCounter.Since(time.Now())
+	}
 	T := P
 	if G == P { // Must use temporary in case G == P
 		T = &basicPoint{}
@@ -9,12 +9,16 @@ import (
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/mod"
+	"go.dedis.ch/kyber/v3/util/metrics"
 	"go.dedis.ch/kyber/v3/util/random"
 )
 
 var zero = big.NewInt(0)
 var one = big.NewInt(1)
 
+// mulCounter counts the scalar multiplications of all point representations.
+var mulCounter = metrics.NewCounter("curve25519.Mul")
+
 // Extension of Point interface for elliptic curve X,Y coordinate access
 type point interface {
 	kyber.Point
@@ -50,6 +54,13 @@ func (c *curve) IsPrimeOrder() bool {
 	return !c.full
 }
 
+// Cofactor returns the cofactor of the curve. Decoded points are not checked
+// to be in the prime-order subgroup, so they may have a component of small
+// order even if IsPrimeOrder. It implements kyber.Cofactored.
+func (c *curve) Cofactor() int64 {
+	return c.cofact.V.Int64()
+}
+
 // Returns the size in bytes of an encoded Scalar for this curve.
 func (c *curve) ScalarLen() int {
 	return (c.order.V.BitLen() + 7) / 8
@@ -5,10 +5,12 @@ import (
 	"encoding/hex"
 	"io"
 	"math/big"
+	"time"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
 	"go.dedis.ch/kyber/v3/group/mod"
+	"go.dedis.ch/kyber/v3/util/metrics"
 )
 
 type extPoint struct {
@@ -236,6 +238,9 @@ func (P *extPoint) Mul(s kyber.Scalar, G kyber.Point) kyber.Point {
 	if G == nil {
 		return P.Base().Mul(s, P)
 	}
+	if metrics.Enabled {
+		defer mulCounter.Since(time.Now())
+	}
 	T := P
 	if G == P { // Must use temporary for in-place multiply
 		T = &extPoint{}
@@ -4,10 +4,12 @@ import (
 	"crypto/cipher"
 	"io"
 	"math/big"
+	"time"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
 	"go.dedis.ch/kyber/v3/group/mod"
+	"go.dedis.ch/kyber/v3/util/metrics"
 )
 
 type projPoint struct {
@@ -216,6 +218,9 @@ func (P *projPoint) Mul(s kyber.Scalar, G kyber.Point) kyber.Point {
 	if G == nil {
 		return P.Base().Mul(s, P)
 	}
+	if metrics.Enabled {
+		defer mulCounter.Since(time.Now())
+	}
 	T := P
 	if G == P { // Must use temporary for in-place multiply
 		T = &projPoint{}
@@ -2,7 +2,6 @@ package curve25519
 
 import (
 	"crypto/cipher"
-	"crypto/sha256"
 	"hash"
 	"io"
 	"reflect"
@@ -10,6 +9,7 @@ import (
 	"go.dedis.ch/fixbuf"
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
+	"go.dedis.ch/kyber/v3/util/hashpool"
 	"go.dedis.ch/kyber/v3/util/random"
 	"go.dedis.ch/kyber/v3/xof/blake2xb"
 )
@@ -19,14 +19,26 @@ type SuiteCurve25519 struct {
 	ProjectiveCurve
 }
 
-// Hash returns the instance associated with the suite
+// Hash returns a SHA-256 hash, reusing one given back to PutHash if there is
+// any.
 func (s *SuiteCurve25519) Hash() hash.Hash {
-	return sha256.New()
+	return hashpool.SHA256()
 }
 
-// XOF creates the XOF associated with the suite
+// PutHash gives back h, which must no longer be used, for Hash to reuse.
+func (s *SuiteCurve25519) PutHash(h hash.Hash) {
+	hashpool.Put(h)
+}
+
+// XOF returns an XOF implemented with Blake2b, reusing one given back to
+// PutXOF if there is any.
 func (s *SuiteCurve25519) XOF(seed []byte) kyber.XOF {
-	return blake2xb.New(seed)
+	return blake2xb.Get(seed)
+}
+
+// PutXOF gives back x, which must no longer be used, for XOF to reuse.
+func (s *SuiteCurve25519) PutXOF(x kyber.XOF) {
+	blake2xb.Put(x)
 }
 
 func (s *SuiteCurve25519) Read(r io.Reader, objs ...interface{}) error {
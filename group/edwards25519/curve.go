@@ -39,6 +39,12 @@ func (c *Curve) PointLen() int {
 	return 32
 }
 
+// Cofactor returns 8, the cofactor of the Ed25519 curve, whose points may
+// have a component of small order. It implements kyber.Cofactored.
+func (c *Curve) Cofactor() int64 {
+	return 8
+}
+
 // Point creates a new Point on the Ed25519 curve.
 func (c *Curve) Point() kyber.Point {
 	P := new(point)
@@ -0,0 +1,152 @@
+// +build amd64,!generic
+
+package edwards25519
+
+import (
+	"encoding/binary"
+
+	"golang.org/x/sys/cpu"
+)
+
+// fieldElement represents an element of the field GF(2^255 - 19).  An element
+// t, entries t[0]...t[4], represents the integer t[0]+2^51 t[1]+2^102 t[2]+
+// 2^153 t[3]+2^204 t[4].  All functions return limbs below 2^51 + 2^18, which
+// keeps the sums of the 128-bit products in feMul and feSquare, and their
+// carries, from overflowing.
+type fieldElement [5]uint64
+
+const maskLow51Bits = 1<<51 - 1
+
+// hasBMI2 selects the MULX multiplication of feMul and feSquare.
+var hasBMI2 = cpu.X86.HasBMI2
+
+// feMul sets out = a * b. Can overlap out with a or b.
+//go:noescape
+func feMul(out, a, b *fieldElement)
+
+// feSquare sets out = a * a. Can overlap out with a.
+//go:noescape
+func feSquare(out, a *fieldElement)
+
+// feSquare2 sets h = 2 * f * f. Can overlap h with f.
+func feSquare2(h, f *fieldElement) {
+	feSquare(h, f)
+	feAdd(h, h, h)
+}
+
+func feZero(fe *fieldElement) {
+	*fe = fieldElement{}
+}
+
+func feOne(fe *fieldElement) {
+	*fe = fieldElement{1}
+}
+
+// feCarry reduces the limbs of fe below 2^52.
+func feCarry(fe *fieldElement) {
+	c0 := fe[0] >> 51
+	c1 := fe[1] >> 51
+	c2 := fe[2] >> 51
+	c3 := fe[3] >> 51
+	c4 := fe[4] >> 51
+
+	fe[0] = fe[0]&maskLow51Bits + c4*19
+	fe[1] = fe[1]&maskLow51Bits + c0
+	fe[2] = fe[2]&maskLow51Bits + c1
+	fe[3] = fe[3]&maskLow51Bits + c2
+	fe[4] = fe[4]&maskLow51Bits + c3
+}
+
+func feAdd(dst, a, b *fieldElement) {
+	dst[0] = a[0] + b[0]
+	dst[1] = a[1] + b[1]
+	dst[2] = a[2] + b[2]
+	dst[3] = a[3] + b[3]
+	dst[4] = a[4] + b[4]
+	feCarry(dst)
+}
+
+// feSub sets dst = a - b as a + 2p - b, whose limbs do not underflow.
+func feSub(dst, a, b *fieldElement) {
+	dst[0] = (a[0] + 0xFFFFFFFFFFFDA) - b[0]
+	dst[1] = (a[1] + 0xFFFFFFFFFFFFE) - b[1]
+	dst[2] = (a[2] + 0xFFFFFFFFFFFFE) - b[2]
+	dst[3] = (a[3] + 0xFFFFFFFFFFFFE) - b[3]
+	dst[4] = (a[4] + 0xFFFFFFFFFFFFE) - b[4]
+	feCarry(dst)
+}
+
+func feNeg(h, f *fieldElement) {
+	feSub(h, &fieldElement{}, f)
+}
+
+func feCopy(dst, src *fieldElement) {
+	*dst = *src
+}
+
+// Replace (f,g) with (g,g) if b == 1;
+// replace (f,g) with (f,g) if b == 0.
+//
+// Preconditions: b in {0,1}.
+func feCMove(f, g *fieldElement, b int32) {
+	mask := -uint64(b)
+	f[0] ^= mask & (f[0] ^ g[0])
+	f[1] ^= mask & (f[1] ^ g[1])
+	f[2] ^= mask & (f[2] ^ g[2])
+	f[3] ^= mask & (f[3] ^ g[3])
+	f[4] ^= mask & (f[4] ^ g[4])
+}
+
+// feFromBytes sets dst to the little-endian integer in the first 32 bytes of
+// src, ignoring its top bit.
+func feFromBytes(dst *fieldElement, src []byte) {
+	_ = src[31] // bounds check hint to the compiler
+	dst[0] = binary.LittleEndian.Uint64(src[0:8]) & maskLow51Bits
+	dst[1] = (binary.LittleEndian.Uint64(src[6:14]) >> 3) & maskLow51Bits
+	dst[2] = (binary.LittleEndian.Uint64(src[12:20]) >> 6) & maskLow51Bits
+	dst[3] = (binary.LittleEndian.Uint64(src[19:27]) >> 1) & maskLow51Bits
+	dst[4] = (binary.LittleEndian.Uint64(src[24:32]) >> 12) & maskLow51Bits
+}
+
+// feToBytes marshals h, reduced mod p, to s.
+func feToBytes(s *[32]byte, h *fieldElement) {
+	t := *h
+	feCarry(&t)
+
+	// t < 2^255 + 2^13·19, so it is t mod p, minus p if t >= p, which is
+	// the case if t + 19 >= 2^255.
+	q := (t[0] + 19) >> 51
+	q = (t[1] + q) >> 51
+	q = (t[2] + q) >> 51
+	q = (t[3] + q) >> 51
+	q = (t[4] + q) >> 51
+
+	// t - q·p = t + 19q - 2^255·q, where the last term is the carry out of
+	// the top limb, which is dropped.
+	t[0] += 19 * q
+	t[1] += t[0] >> 51
+	t[0] &= maskLow51Bits
+	t[2] += t[1] >> 51
+	t[1] &= maskLow51Bits
+	t[3] += t[2] >> 51
+	t[2] &= maskLow51Bits
+	t[4] += t[3] >> 51
+	t[3] &= maskLow51Bits
+	t[4] &= maskLow51Bits
+
+	binary.LittleEndian.PutUint64(s[0:8], t[0]|t[1]<<51)
+	binary.LittleEndian.PutUint64(s[8:16], t[1]>>13|t[2]<<38)
+	binary.LittleEndian.PutUint64(s[16:24], t[2]>>26|t[3]<<25)
+	binary.LittleEndian.PutUint64(s[24:32], t[3]>>39|t[4]<<12)
+}
+
+// feFromFe10 returns the element f in the representation of fieldElement.
+func feFromFe10(f *fe10) fieldElement {
+	var s [32]byte
+	t := *f
+	fe10ToBytes(&s, &t)
+
+	var e fieldElement
+	feFromBytes(&e, s[:])
+	return e
+}
@@ -0,0 +1,332 @@
+// +build amd64,!generic
+
+// The products of feMul and feSquare are accumulated as 128-bit sums in the
+// register pairs r0 = (DI, SI), r1 = (R9, R8), r2 = (R11, R10), r3 = (R13,
+// R12) and r4 = (R15, R14), low word first, of which feReduce makes a
+// fieldElement.
+
+// mulAddBMI2 adds the 128-bit product src·DX to (lo, hi), using AX and BX.
+#define mulAddBMI2(src, lo, hi) \
+	MULXQ src, AX, BX \
+	ADDQ  AX, lo \
+	ADCQ  BX, hi
+
+// mulAdd adds the 128-bit product AX·src to (lo, hi), and overwrites DX.
+#define mulAdd(src, lo, hi) \
+	MULQ src \
+	ADDQ AX, lo \
+	ADCQ DX, hi
+
+// feReduce carries r0, ..., r4 twice down to limbs below 2^52 in DI, R9,
+// R11, R13 and R15, folding the carry out of r4 back into r0 times 19.
+#define feReduce() \
+	MOVQ   $0x0007ffffffffffff, AX \
+	SHLQ   $13, DI, SI \
+	ANDQ   AX, DI \
+	SHLQ   $13, R9, R8 \
+	ANDQ   AX, R9 \
+	ADDQ   SI, R9 \
+	SHLQ   $13, R11, R10 \
+	ANDQ   AX, R11 \
+	ADDQ   R8, R11 \
+	SHLQ   $13, R13, R12 \
+	ANDQ   AX, R13 \
+	ADDQ   R10, R13 \
+	SHLQ   $13, R15, R14 \
+	ANDQ   AX, R15 \
+	ADDQ   R12, R15 \
+	IMUL3Q $19, R14, R14 \
+	ADDQ   R14, DI \
+	\
+	MOVQ   DI, SI \
+	SHRQ   $51, SI \
+	MOVQ   R9, R8 \
+	SHRQ   $51, R8 \
+	MOVQ   R11, R10 \
+	SHRQ   $51, R10 \
+	MOVQ   R13, R12 \
+	SHRQ   $51, R12 \
+	MOVQ   R15, R14 \
+	SHRQ   $51, R14 \
+	ANDQ   AX, DI \
+	IMUL3Q $19, R14, R14 \
+	ADDQ   R14, DI \
+	ANDQ   AX, R9 \
+	ADDQ   SI, R9 \
+	ANDQ   AX, R11 \
+	ADDQ   R8, R11 \
+	ANDQ   AX, R13 \
+	ADDQ   R10, R13 \
+	ANDQ   AX, R15 \
+	ADDQ   R12, R15
+
+#define storeElement(r) \
+	MOVQ DI, 0+r \
+	MOVQ R9, 8+r \
+	MOVQ R11, 16+r \
+	MOVQ R13, 24+r \
+	MOVQ R15, 32+r
+
+// func feMul(out, a, b *fieldElement)
+TEXT ·feMul(SB),0,$40-24
+	MOVQ a+8(FP), CX
+	MOVQ b+16(FP), BX
+
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2Mul
+
+	// Multiply the copy of a on the stack by DX = bⱼ, and then by 19bⱼ for
+	// the products that wrap around 2^255. With a on the stack, BX is free
+	// for the products.
+	MOVQ 0(CX), AX
+	MOVQ AX, 0(SP)
+	MOVQ 8(CX), AX
+	MOVQ AX, 8(SP)
+	MOVQ 16(CX), AX
+	MOVQ AX, 16(SP)
+	MOVQ 24(CX), AX
+	MOVQ AX, 24(SP)
+	MOVQ 32(CX), AX
+	MOVQ AX, 32(SP)
+	MOVQ BX, CX
+
+	MOVQ  0(CX), DX
+	MULXQ 0(SP), DI, SI
+	MULXQ 8(SP), R9, R8
+	MULXQ 16(SP), R11, R10
+	MULXQ 24(SP), R13, R12
+	MULXQ 32(SP), R15, R14
+
+	MOVQ       8(CX), DX
+	mulAddBMI2(0(SP), R9, R8)
+	mulAddBMI2(8(SP), R11, R10)
+	mulAddBMI2(16(SP), R13, R12)
+	mulAddBMI2(24(SP), R15, R14)
+	IMUL3Q     $19, DX, DX
+	mulAddBMI2(32(SP), DI, SI)
+
+	MOVQ       16(CX), DX
+	mulAddBMI2(0(SP), R11, R10)
+	mulAddBMI2(8(SP), R13, R12)
+	mulAddBMI2(16(SP), R15, R14)
+	IMUL3Q     $19, DX, DX
+	mulAddBMI2(24(SP), DI, SI)
+	mulAddBMI2(32(SP), R9, R8)
+
+	MOVQ       24(CX), DX
+	mulAddBMI2(0(SP), R13, R12)
+	mulAddBMI2(8(SP), R15, R14)
+	IMUL3Q     $19, DX, DX
+	mulAddBMI2(16(SP), DI, SI)
+	mulAddBMI2(24(SP), R9, R8)
+	mulAddBMI2(32(SP), R11, R10)
+
+	MOVQ       32(CX), DX
+	mulAddBMI2(0(SP), R15, R14)
+	IMUL3Q     $19, DX, DX
+	mulAddBMI2(8(SP), DI, SI)
+	mulAddBMI2(16(SP), R9, R8)
+	mulAddBMI2(24(SP), R11, R10)
+	mulAddBMI2(32(SP), R13, R12)
+	JMP        reduceMul
+
+nobmi2Mul:
+	// r0 = a0·b0 + 19·(a1·b4 + a2·b3 + a3·b2 + a4·b1)
+	MOVQ   0(CX), AX
+	MULQ   0(BX)
+	MOVQ   AX, DI
+	MOVQ   DX, SI
+	MOVQ   8(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(32(BX), DI, SI)
+	MOVQ   16(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(24(BX), DI, SI)
+	MOVQ   24(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(16(BX), DI, SI)
+	MOVQ   32(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(8(BX), DI, SI)
+
+	// r1 = a0·b1 + a1·b0 + 19·(a2·b4 + a3·b3 + a4·b2)
+	MOVQ   0(CX), AX
+	MULQ   8(BX)
+	MOVQ   AX, R9
+	MOVQ   DX, R8
+	MOVQ   8(CX), AX
+	mulAdd(0(BX), R9, R8)
+	MOVQ   16(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(32(BX), R9, R8)
+	MOVQ   24(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(24(BX), R9, R8)
+	MOVQ   32(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(16(BX), R9, R8)
+
+	// r2 = a0·b2 + a1·b1 + a2·b0 + 19·(a3·b4 + a4·b3)
+	MOVQ   0(CX), AX
+	MULQ   16(BX)
+	MOVQ   AX, R11
+	MOVQ   DX, R10
+	MOVQ   8(CX), AX
+	mulAdd(8(BX), R11, R10)
+	MOVQ   16(CX), AX
+	mulAdd(0(BX), R11, R10)
+	MOVQ   24(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(32(BX), R11, R10)
+	MOVQ   32(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(24(BX), R11, R10)
+
+	// r3 = a0·b3 + a1·b2 + a2·b1 + a3·b0 + 19·a4·b4
+	MOVQ   0(CX), AX
+	MULQ   24(BX)
+	MOVQ   AX, R13
+	MOVQ   DX, R12
+	MOVQ   8(CX), AX
+	mulAdd(16(BX), R13, R12)
+	MOVQ   16(CX), AX
+	mulAdd(8(BX), R13, R12)
+	MOVQ   24(CX), AX
+	mulAdd(0(BX), R13, R12)
+	MOVQ   32(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(32(BX), R13, R12)
+
+	// r4 = a0·b4 + a1·b3 + a2·b2 + a3·b1 + a4·b0
+	MOVQ   0(CX), AX
+	MULQ   32(BX)
+	MOVQ   AX, R15
+	MOVQ   DX, R14
+	MOVQ   8(CX), AX
+	mulAdd(24(BX), R15, R14)
+	MOVQ   16(CX), AX
+	mulAdd(16(BX), R15, R14)
+	MOVQ   24(CX), AX
+	mulAdd(8(BX), R15, R14)
+	MOVQ   32(CX), AX
+	mulAdd(0(BX), R15, R14)
+
+reduceMul:
+	feReduce()
+	MOVQ out+0(FP), AX
+	storeElement(0(AX))
+	RET
+
+// func feSquare(out, a *fieldElement)
+TEXT ·feSquare(SB),0,$0-16
+	MOVQ a+8(FP), CX
+
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2Square
+
+	// r0 = a0² + 38·(a1·a4 + a2·a3)
+	// r1 = 2a0·a1 + 38·a2·a4 + 19·a3²
+	// r2 = 2a0·a2 + a1² + 38·a3·a4
+	// r3 = 2a0·a3 + 2a1·a2 + 19·a4²
+	// r4 = 2a0·a4 + 2a1·a3 + a2²
+	MOVQ  0(CX), DX
+	MULXQ 0(CX), DI, SI
+	SHLQ  $1, DX
+	MULXQ 8(CX), R9, R8
+	MULXQ 16(CX), R11, R10
+	MULXQ 24(CX), R13, R12
+	MULXQ 32(CX), R15, R14
+
+	MOVQ       8(CX), DX
+	mulAddBMI2(8(CX), R11, R10)
+	SHLQ       $1, DX
+	mulAddBMI2(16(CX), R13, R12)
+	mulAddBMI2(24(CX), R15, R14)
+	IMUL3Q     $19, DX, DX
+	mulAddBMI2(32(CX), DI, SI)
+
+	MOVQ       16(CX), DX
+	mulAddBMI2(16(CX), R15, R14)
+	IMUL3Q     $38, DX, DX
+	mulAddBMI2(24(CX), DI, SI)
+	mulAddBMI2(32(CX), R9, R8)
+
+	MOVQ       24(CX), DX
+	IMUL3Q     $19, DX, DX
+	mulAddBMI2(24(CX), R9, R8)
+	SHLQ       $1, DX
+	mulAddBMI2(32(CX), R11, R10)
+
+	MOVQ       32(CX), DX
+	IMUL3Q     $19, DX, DX
+	mulAddBMI2(32(CX), R13, R12)
+	JMP        reduceSquare
+
+nobmi2Square:
+	// r0 = a0² + 38·(a1·a4 + a2·a3)
+	MOVQ   0(CX), AX
+	MULQ   0(CX)
+	MOVQ   AX, DI
+	MOVQ   DX, SI
+	MOVQ   8(CX), AX
+	IMUL3Q $38, AX, AX
+	mulAdd(32(CX), DI, SI)
+	MOVQ   16(CX), AX
+	IMUL3Q $38, AX, AX
+	mulAdd(24(CX), DI, SI)
+
+	// r1 = 2a0·a1 + 38·a2·a4 + 19·a3²
+	MOVQ   0(CX), AX
+	SHLQ   $1, AX
+	MULQ   8(CX)
+	MOVQ   AX, R9
+	MOVQ   DX, R8
+	MOVQ   16(CX), AX
+	IMUL3Q $38, AX, AX
+	mulAdd(32(CX), R9, R8)
+	MOVQ   24(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(24(CX), R9, R8)
+
+	// r2 = 2a0·a2 + a1² + 38·a3·a4
+	MOVQ   0(CX), AX
+	SHLQ   $1, AX
+	MULQ   16(CX)
+	MOVQ   AX, R11
+	MOVQ   DX, R10
+	MOVQ   8(CX), AX
+	mulAdd(8(CX), R11, R10)
+	MOVQ   24(CX), AX
+	IMUL3Q $38, AX, AX
+	mulAdd(32(CX), R11, R10)
+
+	// r3 = 2a0·a3 + 2a1·a2 + 19·a4²
+	MOVQ   0(CX), AX
+	SHLQ   $1, AX
+	MULQ   24(CX)
+	MOVQ   AX, R13
+	MOVQ   DX, R12
+	MOVQ   8(CX), AX
+	SHLQ   $1, AX
+	mulAdd(16(CX), R13, R12)
+	MOVQ   32(CX), AX
+	IMUL3Q $19, AX, AX
+	mulAdd(32(CX), R13, R12)
+
+	// r4 = 2a0·a4 + 2a1·a3 + a2²
+	MOVQ   0(CX), AX
+	SHLQ   $1, AX
+	MULQ   32(CX)
+	MOVQ   AX, R15
+	MOVQ   DX, R14
+	MOVQ   8(CX), AX
+	SHLQ   $1, AX
+	mulAdd(24(CX), R15, R14)
+	MOVQ   16(CX), AX
+	mulAdd(16(CX), R15, R14)
+
+reduceSquare:
+	feReduce()
+	MOVQ out+0(FP), AX
+	storeElement(0(AX))
+	RET
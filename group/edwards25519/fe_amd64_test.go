@@ -0,0 +1,60 @@
+// +build amd64,!generic
+
+package edwards25519
+
+import (
+	"math/big"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+// TestFeMulPaths checks both runtime-selected multiplication paths,
+// whatever the CPU running the test supports, including inputs with the
+// largest limbs that the other functions return.
+func TestFeMulPaths(t *testing.T) {
+	oldBMI2 := hasBMI2
+	defer func() { hasBMI2 = oldBMI2 }()
+
+	paths := []bool{false}
+	if oldBMI2 {
+		paths = append(paths, true)
+	}
+
+	// feCarry, which ends every function but feMul and feSquare, returns
+	// limbs below 2^51 + 2^13·19.
+	const maxLimb = 1<<51 + 1<<13*19 - 1
+	inputs := []*fieldElement{{maxLimb, maxLimb, maxLimb, maxLimb, maxLimb}, {}}
+	for i := 0; i < 1000; i++ {
+		a := randomFe()
+		if i%2 == 1 {
+			for j := range a {
+				a[j] |= 1 << 51
+			}
+		}
+		inputs = append(inputs, a)
+	}
+
+	for _, bmi2 := range paths {
+		hasBMI2 = bmi2
+		for i := 1; i < len(inputs); i++ {
+			a, b := inputs[i-1], inputs[i]
+			x, y := feToBig(a), feToBig(b)
+
+			h := &fieldElement{}
+			feMul(h, a, b)
+			for _, l := range h {
+				require.True(t, l <= maxLimb, "bmi2 %v", bmi2)
+			}
+			exp := new(big.Int).Mul(x, y)
+			requireFe(t, exp.Mod(exp, prime), h, "bmi2 %v", bmi2)
+
+			feSquare(h, a)
+			for _, l := range h {
+				require.True(t, l <= maxLimb, "bmi2 %v", bmi2)
+			}
+			exp = new(big.Int).Mul(x, x)
+			requireFe(t, exp.Mod(exp, prime), h, "bmi2 %v", bmi2)
+		}
+	}
+}
@@ -0,0 +1,122 @@
+package edwards25519
+
+import (
+	"math/big"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3/util/random"
+)
+
+// randomFe returns a random field element, which may be one of the values
+// from p to 2^255-1 that are not reduced.
+func randomFe() *fieldElement {
+	var buf [32]byte
+	random.Bytes(buf[:], random.New())
+	fe := &fieldElement{}
+	feFromBytes(fe, buf[:])
+	return fe
+}
+
+// feToBig returns the integer of fe reduced mod p.
+func feToBig(fe *fieldElement) *big.Int {
+	var s [32]byte
+	feToBytes(&s, fe)
+	for i := 0; i < 16; i++ {
+		s[i], s[31-i] = s[31-i], s[i]
+	}
+	return new(big.Int).SetBytes(s[:])
+}
+
+// requireFe checks that fe is want mod p.
+func requireFe(t *testing.T, want *big.Int, fe *fieldElement, msgAndArgs ...interface{}) {
+	got := feToBig(fe)
+	want = new(big.Int).Mod(want, prime)
+	require.True(t, want.Cmp(got) == 0, "got %v, want %v %v", got, want, msgAndArgs)
+}
+
+func TestFieldElement(t *testing.T) {
+	for i := 0; i < 1000; i++ {
+		a, b := randomFe(), randomFe()
+		x, y := feToBig(a), feToBig(b)
+
+		h := &fieldElement{}
+		feAdd(h, a, b)
+		requireFe(t, new(big.Int).Add(x, y), h)
+		feSub(h, a, b)
+		requireFe(t, new(big.Int).Sub(x, y), h)
+		feNeg(h, a)
+		requireFe(t, new(big.Int).Neg(x), h)
+		feMul(h, a, b)
+		requireFe(t, new(big.Int).Mul(x, y), h)
+		feSquare(h, a)
+		requireFe(t, new(big.Int).Mul(x, x), h)
+		feSquare2(h, a)
+		requireFe(t, new(big.Int).Lsh(new(big.Int).Mul(x, x), 1), h)
+		feInvert(h, a)
+		requireFe(t, new(big.Int).ModInverse(x, prime), h)
+
+		// The operations may overlap their output with their inputs.
+		c := *a
+		feMul(&c, &c, &c)
+		feSquare(h, a)
+		require.Equal(t, *h, c)
+	}
+}
+
+func TestFieldElementBytes(t *testing.T) {
+	for i := 0; i < 100; i++ {
+		var buf, out [32]byte
+		random.Bytes(buf[:], random.New())
+		buf[31] &= 0x7f
+
+		fe := &fieldElement{}
+		feFromBytes(fe, buf[:])
+		feToBytes(&out, fe)
+		x := feToBig(fe)
+		if x.Cmp(new(big.Int).Sub(prime, big.NewInt(1))) < 0 {
+			require.Equal(t, buf, out)
+		}
+	}
+
+	// p-1, p and p+1 are reduced to p-1, 0 and 1.
+	pBytes := [32]byte{0xed}
+	for i := 1; i < 31; i++ {
+		pBytes[i] = 0xff
+	}
+	pBytes[31] = 0x7f
+	for delta, want := range []int64{-1, 0, 1} {
+		buf := pBytes
+		buf[0] += byte(delta - 1)
+		fe := &fieldElement{}
+		feFromBytes(fe, buf[:])
+		exp := new(big.Int).Add(prime, big.NewInt(int64(delta-1)))
+		requireFe(t, exp.Mod(exp, prime), fe, "p%+d", want)
+	}
+}
+
+func TestFieldConstants(t *testing.T) {
+	// d = -121665/121666, d2 = 2d and sqrtM1² = -1.
+	num, den := big.NewInt(-121665), big.NewInt(121666)
+	want := new(big.Int).Mul(num, den.ModInverse(den, prime))
+	want.Mod(want, prime)
+	requireFe(t, want, &d)
+	requireFe(t, want.Mod(want.Lsh(want, 1), prime), &d2)
+
+	h := &fieldElement{}
+	feSquare(h, &sqrtM1)
+	requireFe(t, new(big.Int).Sub(prime, big.NewInt(1)), h)
+
+	// The tables hold the points in the representation of this
+	// architecture: base[0][0] is the base point in precomputed form.
+	var x, y fieldElement
+	recip := &fieldElement{}
+	feInvert(recip, &baseext.Z)
+	feMul(&x, &baseext.X, recip)
+	feMul(&y, &baseext.Y, recip)
+	yPlusX, yMinusX := &fieldElement{}, &fieldElement{}
+	feAdd(yPlusX, &y, &x)
+	feSub(yMinusX, &y, &x)
+	requireFe(t, feToBig(yPlusX), &base[0][0].yPlusX)
+	requireFe(t, feToBig(yMinusX), &base[0][0].yMinusX)
+}
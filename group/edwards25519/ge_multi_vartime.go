@@ -0,0 +1,181 @@
+package edwards25519
+
+import "math/bits"
+
+// msmStrausMax is the number of terms up to which geMultiScalarMultVartime
+// uses Straus' method. Above it, Pippenger's method needs fewer additions.
+const msmStrausMax = 192
+
+// geMultiScalarMultVartime computes h = a[0]*A[0] + ... + a[n-1]*A[n-1] in
+// variable time.
+//
+// Preconditions:
+//   a[i][31] <= 127
+func geMultiScalarMultVartime(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	if len(a) <= msmStrausMax {
+		geStrausVartime(h, a, A)
+	} else {
+		gePippengerVartime(h, a, A)
+	}
+}
+
+// geStrausVartime computes the sum like geScalarMultVartime does for one
+// point, but with the doublings shared among all points.
+func geStrausVartime(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	aSlide := make([][256]int8, len(a))
+	Ai := make([][8]cachedGroupElement, len(a)) // A,3A,5A,7A,9A,11A,13A,15A
+	var t completedGroupElement
+	var u, A2 extendedGroupElement
+	var r projectiveGroupElement
+
+	top := -1
+	for k := range a {
+		slide(&aSlide[k], a[k])
+		for i := 255; i > top; i-- {
+			if aSlide[k][i] != 0 {
+				top = i
+				break
+			}
+		}
+
+		A[k].ToCached(&Ai[k][0])
+		A[k].Double(&t)
+		t.ToExtended(&A2)
+		for i := 0; i < 7; i++ {
+			t.Add(&A2, &Ai[k][i])
+			t.ToExtended(&u)
+			u.ToCached(&Ai[k][i+1])
+		}
+	}
+
+	// t is the neutral element in completed form.
+	feZero(&t.X)
+	feOne(&t.Y)
+	feOne(&t.Z)
+	feOne(&t.T)
+
+	for i := top; i >= 0; i-- {
+		t.ToProjective(&r)
+		r.Double(&t)
+
+		for k := range aSlide {
+			if aSlide[k][i] > 0 {
+				t.ToExtended(&u)
+				t.Add(&u, &Ai[k][aSlide[k][i]/2])
+			} else if aSlide[k][i] < 0 {
+				t.ToExtended(&u)
+				t.Sub(&u, &Ai[k][(-aSlide[k][i])/2])
+			}
+		}
+	}
+
+	t.ToExtended(h)
+}
+
+// gePippengerVartime computes the sum with Pippenger's bucket method: for
+// every window of the signed digits of the scalars, the points are first
+// sorted into buckets by their digit, and the buckets are then summed with
+// their weights using only additions.
+func gePippengerVartime(h *extendedGroupElement, a []*[32]byte,
+	A []*extendedGroupElement) {
+
+	w := pippengerWindow(len(a))
+	digits := make([][]int32, len(a))
+	cached := make([]cachedGroupElement, len(a))
+	for k := range a {
+		digits[k] = recodeSigned(a[k], w)
+		A[k].ToCached(&cached[k])
+	}
+
+	buckets := make([]extendedGroupElement, 1<<(w-1))
+	var sum, run, win extendedGroupElement
+	var c cachedGroupElement
+	var t completedGroupElement
+	var r projectiveGroupElement
+
+	sum.Zero()
+	for i := len(digits[0]) - 1; i >= 0; i-- {
+		sum.ToProjective(&r)
+		for j := uint(0); j < w; j++ {
+			r.Double(&t)
+			t.ToProjective(&r)
+		}
+		t.ToExtended(&sum)
+
+		for b := range buckets {
+			buckets[b].Zero()
+		}
+		for k := range digits {
+			if d := digits[k][i]; d > 0 {
+				t.Add(&buckets[d-1], &cached[k])
+				t.ToExtended(&buckets[d-1])
+			} else if d < 0 {
+				t.Sub(&buckets[-d-1], &cached[k])
+				t.ToExtended(&buckets[-d-1])
+			}
+		}
+
+		// win = sum of (b+1)*buckets[b], as the sum of the running sums
+		// of the buckets from the top.
+		run.Zero()
+		win.Zero()
+		for b := len(buckets) - 1; b >= 0; b-- {
+			buckets[b].ToCached(&c)
+			t.Add(&run, &c)
+			t.ToExtended(&run)
+			run.ToCached(&c)
+			t.Add(&win, &c)
+			t.ToExtended(&win)
+		}
+		win.ToCached(&c)
+		t.Add(&sum, &c)
+		t.ToExtended(&sum)
+	}
+
+	*h = sum
+}
+
+// pippengerWindow returns the window size of Pippenger's method for n
+// scalars, which roughly minimizes the (256/w)*(n + 2^w) additions.
+func pippengerWindow(n int) uint {
+	w := uint(bits.Len(uint(n)))
+	if w > 3 {
+		w -= 3
+	}
+	if w < 4 {
+		w = 4
+	}
+	if w > 16 {
+		w = 16
+	}
+	return w
+}
+
+// recodeSigned returns the digits d[i] of the little-endian a in base 2^w,
+// least significant first, with -2^(w-1) <= d[i] < 2^(w-1).
+func recodeSigned(a *[32]byte, w uint) []int32 {
+	d := make([]int32, (256+w-1)/w+1)
+	mask := uint32(1)<<w - 1
+	half := int32(1) << (w - 1)
+	var carry int32
+	for i := range d {
+		pos := uint(i) * w
+		var v uint32
+		for j := uint(0); j < 3 && pos/8+j < 32; j++ {
+			v |= uint32(a[pos/8+j]) << (8 * j)
+		}
+
+		di := int32((v>>(pos%8))&mask) + carry
+		carry = 0
+		if di >= half {
+			di -= 2 * half
+			carry = 1
+		}
+		d[i] = di
+	}
+	return d
+}
@@ -19,9 +19,11 @@ import (
 	"encoding/hex"
 	"errors"
 	"io"
+	"time"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
+	"go.dedis.ch/kyber/v3/util/metrics"
 )
 
 var marshalPointID = [8]byte{'e', 'd', '.', 'p', 'o', 'i', 'n', 't'}
@@ -212,8 +214,16 @@ func (P *point) Neg(A kyber.Point) kyber.Point {
 	return P
 }
 
+var (
+	mulCounter            = metrics.NewCounter("edwards25519.Mul")
+	multiScalarMulCounter = metrics.NewCounter("edwards25519.MultiScalarMul")
+)
+
 // Mul multiplies point p by scalar s using the repeated doubling method.
 func (P *point) Mul(s kyber.Scalar, A kyber.Point) kyber.Point {
+	if metrics.Enabled {
+		defer mulCounter.Since(time.Now())
+	}
 
 	a := &s.(*scalar).v
 
@@ -229,3 +239,28 @@ func (P *point) Mul(s kyber.Scalar, A kyber.Point) kyber.Point {
 
 	return P
 }
+
+// MultiScalarMul sets P to the sum of scalars[i]*points[i] and returns P.
+// A nil point stands for the base point. It runs in variable time, so only
+// use it on public scalars and points.
+func (P *point) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("edwards25519: mismatched number of scalars and points")
+	}
+	if metrics.Enabled {
+		defer multiScalarMulCounter.Since(time.Now())
+	}
+
+	a := make([]*[32]byte, len(scalars))
+	A := make([]*extendedGroupElement, len(points))
+	for i := range scalars {
+		a[i] = &scalars[i].(*scalar).v
+		if points[i] == nil {
+			A[i] = &baseext
+		} else {
+			A[i] = &points[i].(*point).ge
+		}
+	}
+	geMultiScalarMultVartime(&P.ge, a, A)
+	return P
+}
@@ -5,9 +5,29 @@ import (
 	"testing"
 
 	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3"
 )
 
 func TestPoint_Marshal(t *testing.T) {
 	p := point{}
 	require.Equal(t, "ed.point", fmt.Sprintf("%s", p.MarshalID()))
 }
+
+func TestPoint_MultiScalarMul(t *testing.T) {
+	// The sizes cover both Straus' and Pippenger's method.
+	for _, n := range []int{0, 1, 5, msmStrausMax + 1, 1000} {
+		scalars := make([]kyber.Scalar, n)
+		points := make([]kyber.Point, n)
+		want := tSuite.Point().Null()
+		for i := range scalars {
+			scalars[i] = tSuite.Scalar().Pick(tSuite.RandomStream())
+			if i%7 != 3 {
+				points[i] = tSuite.Point().Pick(tSuite.RandomStream())
+			}
+			want.Add(want, tSuite.Point().Mul(scalars[i], points[i]))
+		}
+
+		got := tSuite.Point().(kyber.MultiScalarMultiplier).MultiScalarMul(scalars, points)
+		require.True(t, got.Equal(want), "MultiScalarMul of %d terms", n)
+	}
+}
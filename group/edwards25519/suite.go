@@ -2,7 +2,6 @@ package edwards25519
 
 import (
 	"crypto/cipher"
-	"crypto/sha256"
 	"hash"
 	"io"
 	"reflect"
@@ -10,6 +9,7 @@ import (
 	"go.dedis.ch/fixbuf"
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
+	"go.dedis.ch/kyber/v3/util/hashpool"
 	"go.dedis.ch/kyber/v3/util/random"
 	"go.dedis.ch/kyber/v3/xof/blake2xb"
 )
@@ -21,14 +21,26 @@ type SuiteEd25519 struct {
 	r cipher.Stream
 }
 
-// Hash returns a newly instanciated sha256 hash function.
+// Hash returns a SHA-256 hash, reusing one given back to PutHash if there is
+// any.
 func (s *SuiteEd25519) Hash() hash.Hash {
-	return sha256.New()
+	return hashpool.SHA256()
 }
 
-// XOF returns an XOF which is implemented via the Blake2b hash.
+// PutHash gives back h, which must no longer be used, for Hash to reuse.
+func (s *SuiteEd25519) PutHash(h hash.Hash) {
+	hashpool.Put(h)
+}
+
+// XOF returns an XOF implemented with Blake2b, reusing one given back to
+// PutXOF if there is any.
 func (s *SuiteEd25519) XOF(key []byte) kyber.XOF {
-	return blake2xb.New(key)
+	return blake2xb.Get(key)
+}
+
+// PutXOF gives back x, which must no longer be used, for XOF to reuse.
+func (s *SuiteEd25519) PutXOF(x kyber.XOF) {
+	blake2xb.Put(x)
 }
 
 func (s *SuiteEd25519) Read(r io.Reader, objs ...interface{}) error {
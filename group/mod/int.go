@@ -1,5 +1,11 @@
 // Package mod contains a generic implementation of finite field arithmetic
 // on integer fields with a constant modulus.
+//
+// Int is based on big.Int. Int256 is a fixed-size alternative for moduli below
+// 2^256; it is now what the Scalar methods of the bn256 groups and of the NIST
+// P-256 group return, instead of Int. Code that type-asserts those scalars to
+// *Int must assert *Int256 instead, or use BigInt to get their value. Int256
+// accepts Int operands with the same modulus, but Int needs Int operands.
 package mod
 
 import (
@@ -8,6 +14,7 @@ import (
 	"errors"
 	"io"
 	"math/big"
+	"math/bits"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
@@ -313,20 +320,38 @@ func (i *Int) MarshalSize() int {
 // MarshalBinary encodes the value of this Int into a byte-slice exactly Len() bytes long.
 // It uses i's ByteOrder to determine which byte order to output.
 func (i *Int) MarshalBinary() ([]byte, error) {
-	l := i.MarshalSize()
-	b := i.V.Bytes() // may be shorter than l
-	offset := l - len(b)
+	return i.AppendBinary(make([]byte, 0, i.MarshalSize()))
+}
 
-	if i.BO == LittleEndian {
-		return i.LittleEndian(l, l), nil
+// AppendBinary appends the MarshalBinary encoding of i to b and returns the
+// extended buffer. It does not allocate if b has enough spare capacity.
+func (i *Int) AppendBinary(b []byte) ([]byte, error) {
+	l := i.MarshalSize()
+	var ret []byte
+	if total := len(b) + l; cap(b) >= total {
+		ret = b[:total]
+	} else {
+		ret = make([]byte, total)
+		copy(ret, b)
 	}
-
-	if offset != 0 {
-		nb := make([]byte, l)
-		copy(nb[offset:], b)
-		b = nb
+	out := ret[len(b):]
+
+	// Write the bytes of the words of V straight into out, least
+	// significant first.
+	const wordBytes = bits.UintSize / 8
+	words := i.V.Bits()
+	for k := 0; k < l; k++ {
+		var v byte
+		if w := k / wordBytes; w < len(words) {
+			v = byte(words[w] >> (8 * uint(k%wordBytes)))
+		}
+		if i.BO == LittleEndian {
+			out[k] = v
+		} else {
+			out[l-1-k] = v
+		}
 	}
-	return b, nil
+	return ret, nil
 }
 
 // MarshalID returns a unique identifier for this type
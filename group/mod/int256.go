@@ -0,0 +1,509 @@
+package mod
+
+import (
+	"crypto/cipher"
+	"encoding/hex"
+	"errors"
+	"io"
+	"math/big"
+	"math/bits"
+
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/group/internal/marshalling"
+	"go.dedis.ch/kyber/v3/util/random"
+)
+
+// Modulus256 holds an odd modulus M below 2^256 with the constants of the
+// Montgomery arithmetic of Int256 modulo M. It is created once per modulus
+// and shared by all Int256 with that modulus.
+type Modulus256 struct {
+	M *big.Int // Modulus, which must not change
+
+	m    [4]uint64 // M as little-endian 64-bit words
+	np   uint64    // -M^-1 mod 2^64
+	r2   [4]uint64 // 2^512 mod M
+	r3   [4]uint64 // 2^768 mod M
+	one  [4]uint64 // 2^256 mod M, the Montgomery form of 1
+	size int       // Bytes in the encoding of an Int256
+}
+
+// NewModulus256 returns the Modulus256 of m, which must be odd and below
+// 2^256.
+func NewModulus256(m *big.Int) *Modulus256 {
+	if m.Sign() <= 0 || m.Bit(0) == 0 || m.BitLen() > 256 {
+		panic("mod: Modulus256 needs an odd modulus below 2^256")
+	}
+	mod := &Modulus256{M: m, size: (m.BitLen() + 7) / 8}
+	bigToWords(&mod.m, m)
+
+	// Newton's iteration doubles the number of correct low bits of the
+	// inverse of m[0], starting from the 3 bits of m[0] itself.
+	inv := mod.m[0]
+	for i := 0; i < 5; i++ {
+		inv *= 2 - mod.m[0]*inv
+	}
+	mod.np = -inv
+
+	r := new(big.Int).Lsh(one, 256)
+	bigToWords(&mod.one, new(big.Int).Mod(r, m))
+	bigToWords(&mod.r2, new(big.Int).Exp(r, two, m))
+	bigToWords(&mod.r3, new(big.Int).Exp(r, big.NewInt(3), m))
+	return mod
+}
+
+// Int256 is an integer modulo a Modulus256, which implements kyber.Scalar
+// like Int, and with the same binary encoding as an Int in big-endian byte
+// order, but with fixed-size Montgomery arithmetic instead of big.Int. Its
+// operations do not allocate, and all but Inv take constant time.
+//
+// As for Int, unary and binary operations may be performed on uninitialized
+// targets, which receive the modulus of the first operand. The operands may
+// also be Int with the same modulus, such as the scalars of groups whose
+// Scalar returned Int before Int256: they are converted, which allocates.
+type Int256 struct {
+	v [4]uint64 // The value times 2^256 mod M, below M
+	m *Modulus256
+}
+
+// NewInt256 creates a new Int256 with a given int64 value and modulus.
+func NewInt256(v int64, m *Modulus256) *Int256 {
+	i := &Int256{m: m}
+	i.SetInt64(v)
+	return i
+}
+
+// Modulus returns the modulus of i.
+func (i *Int256) Modulus() *Modulus256 {
+	return i.m
+}
+
+// words returns the value of i as little-endian 64-bit words.
+func (i *Int256) words() (w [4]uint64) {
+	montMul(&w, &i.v, &[4]uint64{1}, &i.m.m, i.m.np)
+	return w
+}
+
+// setWords sets i to w, which must be below 2^256.
+func (i *Int256) setWords(w *[4]uint64) {
+	montMul(&i.v, w, &i.m.r2, &i.m.m, i.m.np)
+}
+
+// Words returns the value of i as little-endian 64-bit words.
+func (i *Int256) Words() [4]uint64 {
+	return i.words()
+}
+
+// BigInt returns the value of i as a new big.Int.
+func (i *Int256) BigInt() *big.Int {
+	w := i.words()
+	const wordsPer = 64 / bits.UintSize
+	z := make([]big.Word, 4*wordsPer)
+	for k := range z {
+		z[k] = big.Word(w[k/wordsPer] >> (uint(k%wordsPer) * bits.UintSize))
+	}
+	return new(big.Int).SetBits(z)
+}
+
+// SetBigInt sets i to v mod M.
+func (i *Int256) SetBigInt(v *big.Int) *Int256 {
+	var w [4]uint64
+	bigToWords(&w, new(big.Int).Mod(v, i.m.M))
+	i.setWords(&w)
+	return i
+}
+
+// Return the Int256's integer value in hexadecimal string representation.
+func (i *Int256) String() string {
+	var buf [32]byte
+	b := i.appendBytes(buf[:0])
+	for len(b) > 0 && b[0] == 0 {
+		b = b[1:]
+	}
+	return hex.EncodeToString(b)
+}
+
+// toInt256 returns a as an Int256. An Int is converted with the modulus m,
+// or with its own if m is nil.
+func toInt256(a kyber.Scalar, m *Modulus256) *Int256 {
+	switch ai := a.(type) {
+	case *Int256:
+		return ai
+	case *Int:
+		if m == nil {
+			m = NewModulus256(ai.M)
+		} else if ai.M.Cmp(m.M) != 0 {
+			panic("mod: Int256 operand with a different modulus")
+		}
+		return (&Int256{m: m}).SetBigInt(&ai.V)
+	}
+	panic("mod: Int256 operands must be Int256 or Int")
+}
+
+// operand returns a as an Int256, converted with i's modulus if needed.
+func (i *Int256) operand(a kyber.Scalar) *Int256 {
+	if ai, ok := a.(*Int256); ok {
+		return ai
+	}
+	return toInt256(a, i.m)
+}
+
+// operands returns a and b, which are not both Int256, converted to Int256
+// with the modulus of the other operand, or else of i. The callers check for
+// Int256 themselves, so that their usual case does not need a call.
+func (i *Int256) operands(a, b kyber.Scalar) (*Int256, *Int256) {
+	if bi, ok := b.(*Int256); ok {
+		return toInt256(a, bi.m), bi
+	}
+	ai := toInt256(a, i.m)
+	return ai, toInt256(b, ai.m)
+}
+
+// Equal returns true if i and s2 are equal. s2 may be an Int, which is equal
+// if it has the same modulus and value.
+func (i *Int256) Equal(s2 kyber.Scalar) bool {
+	switch s := s2.(type) {
+	case *Int256:
+		return i.v == s.v
+	case *Int:
+		return s.M.Cmp(i.m.M) == 0 && s.V.Cmp(i.BigInt()) == 0
+	}
+	return false
+}
+
+// Set both value and modulus to be equal to another Int256, or to an Int.
+func (i *Int256) Set(a kyber.Scalar) kyber.Scalar {
+	*i = *i.operand(a)
+	return i
+}
+
+// Clone returns a separate duplicate of this Int256.
+func (i *Int256) Clone() kyber.Scalar {
+	ni := *i
+	return &ni
+}
+
+// Zero set the Int256 to the value 0. The modulus must already be
+// initialized.
+func (i *Int256) Zero() kyber.Scalar {
+	i.v = [4]uint64{}
+	return i
+}
+
+// One sets the Int256 to the value 1. The modulus must already be
+// initialized.
+func (i *Int256) One() kyber.Scalar {
+	i.v = i.m.one
+	return i
+}
+
+// SetInt64 sets the Int256 to an arbitrary 64-bit "small integer" value.
+// The modulus must already be initialized.
+func (i *Int256) SetInt64(v int64) kyber.Scalar {
+	if v >= 0 {
+		i.setWords(&[4]uint64{uint64(v)})
+		return i
+	}
+	i.setWords(&[4]uint64{uint64(-v)})
+	return i.Neg(i)
+}
+
+// Add sets the target to a + b mod M, where M is a's modulus.
+func (i *Int256) Add(a, b kyber.Scalar) kyber.Scalar {
+	ai, aok := a.(*Int256)
+	bi, bok := b.(*Int256)
+	if !aok || !bok {
+		ai, bi = i.operands(a, b)
+	}
+	i.m = ai.m
+	addMod(&i.v, &ai.v, &bi.v, &i.m.m)
+	return i
+}
+
+// Sub sets the target to a - b mod M.
+// Target receives a's modulus.
+func (i *Int256) Sub(a, b kyber.Scalar) kyber.Scalar {
+	ai, aok := a.(*Int256)
+	bi, bok := b.(*Int256)
+	if !aok || !bok {
+		ai, bi = i.operands(a, b)
+	}
+	i.m = ai.m
+	subMod(&i.v, &ai.v, &bi.v, &i.m.m)
+	return i
+}
+
+// Neg sets the target to -a mod M.
+func (i *Int256) Neg(a kyber.Scalar) kyber.Scalar {
+	ai := i.operand(a)
+	i.m = ai.m
+	subMod(&i.v, &[4]uint64{}, &ai.v, &i.m.m)
+	return i
+}
+
+// Mul sets the target to a * b mod M.
+// Target receives a's modulus.
+func (i *Int256) Mul(a, b kyber.Scalar) kyber.Scalar {
+	ai, aok := a.(*Int256)
+	bi, bok := b.(*Int256)
+	if !aok || !bok {
+		ai, bi = i.operands(a, b)
+	}
+	i.m = ai.m
+	montMul(&i.v, &ai.v, &bi.v, &i.m.m, i.m.np)
+	return i
+}
+
+// Div sets the target to a * b^-1 mod M, where b^-1 is the modular inverse
+// of b.
+func (i *Int256) Div(a, b kyber.Scalar) kyber.Scalar {
+	ai := i.operand(a)
+	var t Int256
+	t.m = ai.m
+	t.Inv(b)
+	i.m = ai.m
+	montMul(&i.v, &ai.v, &t.v, &i.m.m, i.m.np)
+	return i
+}
+
+// Inv sets the target to the modular inverse of a with respect to modulus
+// M, and maps 0 to 0. As for Int, it takes variable time.
+func (i *Int256) Inv(a kyber.Scalar) kyber.Scalar {
+	ai := i.operand(a)
+	m := ai.m
+	i.m = m
+	if ai.v == ([4]uint64{}) {
+		i.v = ai.v
+		return i
+	}
+	// The inverse of the Montgomery form a·2^256 is a^-1·2^-256, whose
+	// Montgomery form is its product with 2^512, that is montMul with
+	// 2^768.
+	var t [4]uint64
+	invVartime(&t, &ai.v, &m.m)
+	montMul(&i.v, &t, &m.r3, &m.m, m.np)
+	return i
+}
+
+// Pick a [pseudo-]random integer modulo M using bits from the given stream
+// cipher, the same way as Int.Pick.
+func (i *Int256) Pick(rand cipher.Stream) kyber.Scalar {
+	return i.SetBigInt(random.Int(i.m.M, rand))
+}
+
+// SetBytes sets the value to the big-endian integer a, reduced mod M.
+func (i *Int256) SetBytes(a []byte) kyber.Scalar {
+	// Horner's rule on the chunks of 32 bytes, the most significant first,
+	// which may be shorter: acc = acc·2^256 + chunk.
+	var acc, c [4]uint64
+	for len(a) > 0 {
+		n := len(a) - (len(a)-1)/32*32
+		bytesToWords(&c, a[:n])
+		a = a[n:]
+		montMul(&acc, &acc, &i.m.r2, &i.m.m, i.m.np)
+		montMul(&c, &c, &i.m.r2, &i.m.m, i.m.np)
+		addMod(&acc, &acc, &c, &i.m.m)
+	}
+	i.v = acc
+	return i
+}
+
+// MarshalSize returns the length in bytes of encoded integers with modulus
+// M, as for Int.
+func (i *Int256) MarshalSize() int {
+	return i.m.size
+}
+
+// MarshalBinary encodes the value of this Int256 into a big-endian
+// byte-slice exactly MarshalSize() bytes long.
+func (i *Int256) MarshalBinary() ([]byte, error) {
+	return i.AppendBinary(make([]byte, 0, i.m.size))
+}
+
+// AppendBinary appends the MarshalBinary encoding of i to b and returns the
+// extended buffer. It does not allocate if b has enough spare capacity.
+func (i *Int256) AppendBinary(b []byte) ([]byte, error) {
+	return i.appendBytes(b), nil
+}
+
+func (i *Int256) appendBytes(b []byte) []byte {
+	l := i.m.size
+	var ret []byte
+	if total := len(b) + l; cap(b) >= total {
+		ret = b[:total]
+	} else {
+		ret = make([]byte, total)
+		copy(ret, b)
+	}
+	out := ret[len(b):]
+
+	w := i.words()
+	for k := 0; k < l; k++ {
+		out[l-1-k] = byte(w[k/8] >> (8 * uint(k%8)))
+	}
+	return ret
+}
+
+// MarshalID returns the identifier of Int, whose encoding Int256 shares.
+func (i *Int256) MarshalID() [8]byte {
+	return marshalScalarID
+}
+
+// UnmarshalBinary tries to decode an Int256 from a byte-slice buffer.
+// Returns an error if the buffer is not exactly MarshalSize() bytes long
+// or if the contents of the buffer represents an out-of-range integer.
+func (i *Int256) UnmarshalBinary(buf []byte) error {
+	if len(buf) != i.m.size {
+		return errors.New("UnmarshalBinary: wrong size buffer")
+	}
+	var w [4]uint64
+	bytesToWords(&w, buf)
+	if !lessThan(&w, &i.m.m) {
+		return errors.New("UnmarshalBinary: value out of range")
+	}
+	i.setWords(&w)
+	return nil
+}
+
+// MarshalTo encodes this Int256 to the given Writer.
+func (i *Int256) MarshalTo(w io.Writer) (int, error) {
+	return marshalling.ScalarMarshalTo(i, w)
+}
+
+// UnmarshalFrom tries to decode an Int256 from the given Reader.
+func (i *Int256) UnmarshalFrom(r io.Reader) (int, error) {
+	return marshalling.ScalarUnmarshalFrom(i, r)
+}
+
+// bigToWords sets w to v, which must be below 2^256.
+func bigToWords(w *[4]uint64, v *big.Int) {
+	*w = [4]uint64{}
+	const wordsPer = 64 / bits.UintSize
+	for k, x := range v.Bits() {
+		w[k/wordsPer] |= uint64(x) << (uint(k%wordsPer) * bits.UintSize)
+	}
+}
+
+// bytesToWords sets w to the big-endian integer of at most 32 bytes in b.
+func bytesToWords(w *[4]uint64, b []byte) {
+	*w = [4]uint64{}
+	for k := range b {
+		w[k/8] |= uint64(b[len(b)-1-k]) << (8 * uint(k%8))
+	}
+}
+
+// lessThan returns whether a < b.
+func lessThan(a, b *[4]uint64) bool {
+	var borrow uint64
+	for k := range a {
+		d := a[k] - b[k] - borrow
+		borrow = (b[k]&^a[k] | (b[k]|^a[k])&d) >> 63
+	}
+	return borrow == 1
+}
+
+// addMod sets c = a + b mod m for a, b < m.
+func addMod(c, a, b, m *[4]uint64) {
+	var s, t [4]uint64
+	var carry, borrow uint64
+	for k := range s {
+		s[k] = a[k] + b[k] + carry
+		carry = (a[k]&b[k] | (a[k]|b[k])&^s[k]) >> 63
+	}
+	for k := range t {
+		t[k] = s[k] - m[k] - borrow
+		borrow = (m[k]&^s[k] | (m[k]|^s[k])&t[k]) >> 63
+	}
+	// Keep s if s - m borrows beyond the carry of s.
+	mask := -(borrow &^ carry)
+	for k := range c {
+		c[k] = s[k]&mask | t[k]&^mask
+	}
+}
+
+// invVartime sets c = a^-1 mod m for 0 < a < m and an odd m with the binary
+// extended Euclidean algorithm, which keeps x1·a = u and x2·a = v mod m.
+func invVartime(c, a, m *[4]uint64) {
+	u, v := *a, *m
+	x1, x2 := [4]uint64{1}, [4]uint64{}
+	for !isOne(&u) && !isOne(&v) {
+		for u[0]&1 == 0 {
+			shiftRight1(&u, 0)
+			halveMod(&x1, m)
+		}
+		for v[0]&1 == 0 {
+			shiftRight1(&v, 0)
+			halveMod(&x2, m)
+		}
+		if lessThan(&u, &v) {
+			sub(&v, &v, &u)
+			subMod(&x2, &x2, &x1, m)
+		} else {
+			sub(&u, &u, &v)
+			subMod(&x1, &x1, &x2, m)
+		}
+	}
+	if isOne(&u) {
+		*c = x1
+	} else {
+		*c = x2
+	}
+}
+
+func isOne(a *[4]uint64) bool {
+	return a[0] == 1 && a[1]|a[2]|a[3] == 0
+}
+
+// shiftRight1 sets a to (a + top·2^256) / 2.
+func shiftRight1(a *[4]uint64, top uint64) {
+	a[0] = a[0]>>1 | a[1]<<63
+	a[1] = a[1]>>1 | a[2]<<63
+	a[2] = a[2]>>1 | a[3]<<63
+	a[3] = a[3]>>1 | top<<63
+}
+
+// halveMod sets x to x/2 mod m for x < m.
+func halveMod(x, m *[4]uint64) {
+	// Add m if x is odd, which makes it even, and shift the sum.
+	mask := -(x[0] & 1)
+	m0, m1, m2, m3 := m[0]&mask, m[1]&mask, m[2]&mask, m[3]&mask
+	s0 := x[0] + m0
+	c := (x[0]&m0 | (x[0]|m0)&^s0) >> 63
+	s1 := x[1] + m1 + c
+	c = (x[1]&m1 | (x[1]|m1)&^s1) >> 63
+	s2 := x[2] + m2 + c
+	c = (x[2]&m2 | (x[2]|m2)&^s2) >> 63
+	s3 := x[3] + m3 + c
+	c = (x[3]&m3 | (x[3]|m3)&^s3) >> 63
+	x[0] = s0>>1 | s1<<63
+	x[1] = s1>>1 | s2<<63
+	x[2] = s2>>1 | s3<<63
+	x[3] = s3>>1 | c<<63
+}
+
+// sub sets c = a - b for b <= a.
+func sub(c, a, b *[4]uint64) {
+	var borrow uint64
+	for k := range c {
+		d := a[k] - b[k] - borrow
+		borrow = (b[k]&^a[k] | (b[k]|^a[k])&d) >> 63
+		c[k] = d
+	}
+}
+
+// subMod sets c = a - b mod m for a, b < m.
+func subMod(c, a, b, m *[4]uint64) {
+	var s, t [4]uint64
+	var carry, borrow uint64
+	for k := range s {
+		s[k] = a[k] - b[k] - borrow
+		borrow = (b[k]&^a[k] | (b[k]|^a[k])&s[k]) >> 63
+	}
+	// Add m back if the difference borrowed.
+	mask := -borrow
+	for k := range t {
+		mk := m[k] & mask
+		t[k] = s[k] + mk + carry
+		carry = (s[k]&mk | (s[k]|mk)&^t[k]) >> 63
+	}
+	*c = t
+}
@@ -0,0 +1,107 @@
+// +build amd64,!generic
+
+// montRound adds a·b[i] to the accumulator t0..t4 of montMul, where b[i] is
+// at boff(SI), then adds u·m for u = t0·np, which clears t0, so that the
+// accumulator is t1..t5 afterwards. t5 need not be initialized.
+#define montRound(boff, t0,t1,t2,t3,t4,t5) \
+	XORQ t5, t5 \
+	MOVQ boff(SI), BX \
+	\
+	MOVQ 0(DI), AX \
+	MULQ BX \
+	ADDQ AX, t0 \
+	ADCQ $0, DX \
+	MOVQ DX, R15 \
+	MOVQ 8(DI), AX \
+	MULQ BX \
+	ADDQ R15, t1 \
+	ADCQ $0, DX \
+	ADDQ AX, t1 \
+	ADCQ $0, DX \
+	MOVQ DX, R15 \
+	MOVQ 16(DI), AX \
+	MULQ BX \
+	ADDQ R15, t2 \
+	ADCQ $0, DX \
+	ADDQ AX, t2 \
+	ADCQ $0, DX \
+	MOVQ DX, R15 \
+	MOVQ 24(DI), AX \
+	MULQ BX \
+	ADDQ R15, t3 \
+	ADCQ $0, DX \
+	ADDQ AX, t3 \
+	ADCQ $0, DX \
+	ADDQ DX, t4 \
+	ADCQ $0, t5 \
+	\
+	MOVQ t0, BX \
+	IMULQ R8, BX \
+	MOVQ 0(CX), AX \
+	MULQ BX \
+	ADDQ AX, t0 \
+	ADCQ $0, DX \
+	MOVQ DX, R15 \
+	MOVQ 8(CX), AX \
+	MULQ BX \
+	ADDQ R15, t1 \
+	ADCQ $0, DX \
+	ADDQ AX, t1 \
+	ADCQ $0, DX \
+	MOVQ DX, R15 \
+	MOVQ 16(CX), AX \
+	MULQ BX \
+	ADDQ R15, t2 \
+	ADCQ $0, DX \
+	ADDQ AX, t2 \
+	ADCQ $0, DX \
+	MOVQ DX, R15 \
+	MOVQ 24(CX), AX \
+	MULQ BX \
+	ADDQ R15, t3 \
+	ADCQ $0, DX \
+	ADDQ AX, t3 \
+	ADCQ $0, DX \
+	ADDQ DX, t4 \
+	ADCQ $0, t5
+
+TEXT ·montMul(SB),0,$0-40
+	MOVQ a+8(FP), DI
+	MOVQ b+16(FP), SI
+	MOVQ m+24(FP), CX
+	MOVQ np+32(FP), R8
+
+	XORQ R9, R9
+	XORQ R10, R10
+	XORQ R11, R11
+	XORQ R12, R12
+	XORQ R13, R13
+
+	// The accumulator moves one register up with every round.
+	montRound(0, R9,R10,R11,R12,R13,R14)
+	montRound(8, R10,R11,R12,R13,R14,R9)
+	montRound(16, R11,R12,R13,R14,R9,R10)
+	montRound(24, R12,R13,R14,R9,R10,R11)
+
+	// The result R13,R14,R9,R10,R11 is below 2m: subtract m unless that
+	// borrows beyond R11.
+	MOVQ R13, AX
+	MOVQ R14, BX
+	MOVQ R9, DX
+	MOVQ R10, R15
+	SUBQ 0(CX), AX
+	SBBQ 8(CX), BX
+	SBBQ 16(CX), DX
+	SBBQ 24(CX), R15
+	SBBQ $0, R11
+	CMOVQCC AX, R13
+	CMOVQCC BX, R14
+	CMOVQCC DX, R9
+	CMOVQCC R15, R10
+
+	MOVQ c+0(FP), DI
+	MOVQ R13, 0(DI)
+	MOVQ R14, 8(DI)
+	MOVQ R9, 16(DI)
+	MOVQ R10, 24(DI)
+	RET
@@ -0,0 +1,11 @@
+// +build amd64,!generic
+
+package mod
+
+// This file contains the forward declaration of the assembly implementation
+// of montMul.
+
+// montMul sets c = a·b·2^-256 mod m, given np = -m^-1 mod 2^64, for b < m and
+// a < 2^256. c may overlap a or b.
+//go:noescape
+func montMul(c, a, b, m *[4]uint64, np uint64)
@@ -0,0 +1,64 @@
+// +build !amd64 generic
+
+package mod
+
+// mulWW returns the 128-bit product of x and y as hi, lo.
+func mulWW(x, y uint64) (hi, lo uint64) {
+	const mask32 = 1<<32 - 1
+	x0, x1 := x&mask32, x>>32
+	y0, y1 := y&mask32, y>>32
+	w0 := x0 * y0
+	t := x1*y0 + w0>>32
+	w1, w2 := t&mask32, t>>32
+	w1 += x0 * y1
+	return x1*y1 + w2 + w1>>32, x * y
+}
+
+// mulAdd returns the 128-bit x·y + a + b as hi, lo, which does not overflow.
+func mulAdd(x, y, a, b uint64) (hi, lo uint64) {
+	hi, lo = mulWW(x, y)
+	s := lo + a
+	hi += (lo&a | (lo|a)&^s) >> 63
+	lo = s + b
+	hi += (s&b | (s|b)&^lo) >> 63
+	return hi, lo
+}
+
+// montMul sets c = a·b·2^-256 mod m, given np = -m^-1 mod 2^64, for b < m and
+// a < 2^256, with word-by-word Montgomery multiplication (CIOS). c may
+// overlap a or b.
+func montMul(c, a, b, m *[4]uint64, np uint64) {
+	// t is t[0] + ... + t[4]·2^256, which stays below 2m.
+	var t [5]uint64
+	for _, bi := range b {
+		var carry uint64
+		for j := range a {
+			carry, t[j] = mulAdd(a[j], bi, t[j], carry)
+		}
+		s := t[4] + carry
+		t5 := (t[4]&carry | (t[4]|carry)&^s) >> 63
+		t[4] = s
+
+		// Add u·m with t[0] + u·m[0] = 0 mod 2^64 and shift by a word.
+		u := t[0] * np
+		carry, _ = mulAdd(u, m[0], t[0], 0)
+		for j := 1; j < 4; j++ {
+			carry, t[j-1] = mulAdd(u, m[j], t[j], carry)
+		}
+		s = t[4] + carry
+		t[3] = s
+		t[4] = t5 + (t[4]&carry|(t[4]|carry)&^s)>>63
+	}
+
+	var d [4]uint64
+	var borrow uint64
+	for k := range d {
+		d[k] = t[k] - m[k] - borrow
+		borrow = (m[k]&^t[k] | (m[k]|^t[k])&d[k]) >> 63
+	}
+	// Keep t if t - m borrows beyond t[4].
+	mask := -(borrow &^ t[4])
+	for k := range c {
+		c[k] = t[k]&mask | d[k]&^mask
+	}
+}
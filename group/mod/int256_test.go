@@ -0,0 +1,203 @@
+package mod
+
+import (
+	"crypto/elliptic"
+	"math/big"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/random"
+	"go.dedis.ch/kyber/v3/xof/blake2xb"
+)
+
+// int256Moduli are primes of several sizes, with top words that are small,
+// large or all ones.
+var int256Moduli = []*big.Int{
+	elliptic.P256().Params().N,
+	elliptic.P256().Params().P,
+	new(big.Int).Sub(new(big.Int).Lsh(one, 255), big.NewInt(19)),
+	new(big.Int).Sub(new(big.Int).Lsh(one, 61), one),
+	big.NewInt(65537),
+}
+
+func TestInt256Arithmetic(t *testing.T) {
+	stream := random.New()
+	for _, M := range int256Moduli {
+		m := NewModulus256(M)
+		values := []*big.Int{big.NewInt(0), big.NewInt(1), new(big.Int).Sub(M, one)}
+		for k := 0; k < 50; k++ {
+			values = append(values, random.Int(M, stream))
+		}
+
+		for k := 1; k < len(values); k++ {
+			x, y := values[k-1], values[k]
+			a := NewInt256(0, m).SetBigInt(x)
+			b := NewInt256(0, m).SetBigInt(y)
+			c := NewInt256(0, m)
+			check := func(op string, want *big.Int) {
+				want.Mod(want, M)
+				assert.Equal(t, 0, want.Cmp(c.BigInt()), "%s of %v and %v mod %v", op, x, y, M)
+				w, words := c.Words(), new(big.Int)
+				for i := len(w) - 1; i >= 0; i-- {
+					words.Lsh(words, 64).Or(words, new(big.Int).SetUint64(w[i]))
+				}
+				assert.Equal(t, 0, want.Cmp(words), "Words of %s of %v and %v mod %v", op, x, y, M)
+			}
+			c.Add(a, b)
+			check("Add", new(big.Int).Add(x, y))
+			c.Sub(a, b)
+			check("Sub", new(big.Int).Sub(x, y))
+			c.Neg(a)
+			check("Neg", new(big.Int).Neg(x))
+			c.Mul(a, b)
+			check("Mul", new(big.Int).Mul(x, y))
+			if y.Sign() != 0 {
+				c.Div(a, b)
+				check("Div", new(big.Int).Mul(x, new(big.Int).ModInverse(y, M)))
+				c.Inv(b)
+				check("Inv", new(big.Int).ModInverse(y, M))
+			}
+
+			// The operations may overlap their target with their operands.
+			c.Set(a)
+			c.Mul(c, c)
+			check("Square", new(big.Int).Mul(x, x))
+		}
+	}
+}
+
+// TestInt256Int checks that Int256 and Int in big-endian byte order encode
+// and decode the same values in the same way.
+func TestInt256Int(t *testing.T) {
+	for _, M := range int256Moduli {
+		m := NewModulus256(M)
+		for k := 0; k < 20; k++ {
+			seed := random.Bits(128, false, random.New())
+			i := NewInt64(0, M).Pick(blake2xb.New(seed))
+			j := NewInt256(0, m).Pick(blake2xb.New(seed))
+			assert.Equal(t, i.String(), j.String())
+			assert.Equal(t, i.MarshalSize(), j.MarshalSize())
+			assert.Equal(t, i.(*Int).MarshalID(), j.(*Int256).MarshalID())
+
+			bi, err := i.MarshalBinary()
+			assert.Nil(t, err)
+			bj, err := j.MarshalBinary()
+			assert.Nil(t, err)
+			assert.Equal(t, bi, bj)
+
+			j2 := NewInt256(0, m)
+			assert.Nil(t, j2.UnmarshalBinary(bi))
+			assert.True(t, j.Equal(j2))
+
+			b := random.Bits(uint(8*(k+1)*3), false, random.New())
+			i.SetBytes(b)
+			j.SetBytes(b)
+			assert.Equal(t, i.String(), j.String())
+		}
+
+		j := NewInt256(-5, m)
+		assert.Equal(t, NewInt64(-5, M).String(), j.String())
+		assert.Equal(t, "", j.Zero().String())
+		assert.Equal(t, "01", j.One().String())
+
+		b := M.Bytes()
+		assert.Error(t, j.UnmarshalBinary(b))
+		assert.Error(t, j.UnmarshalBinary(b[1:]))
+	}
+}
+
+func TestInt256IntOperands(t *testing.T) {
+	M := elliptic.P256().Params().N
+	m := NewModulus256(M)
+	x, y := random.Int(M, random.New()), random.Int(M, random.New())
+	a, b := NewInt256(0, m).SetBigInt(x), NewInt256(0, m).SetBigInt(y)
+	ai, bi := NewInt(x, M), NewInt(y, M)
+
+	// Int operands of either side give the same results as Int256 ones.
+	ops := map[string]func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar){
+		"Add": func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar) {
+			return c.Clone().Add(a, b), c.Clone().Add(ai, b)
+		},
+		"Sub": func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar) {
+			return c.Clone().Sub(a, b), c.Clone().Sub(a, bi)
+		},
+		"Mul": func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar) {
+			return c.Clone().Mul(a, b), c.Clone().Mul(ai, bi)
+		},
+		"Div": func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar) {
+			return c.Clone().Div(a, b), c.Clone().Div(ai, bi)
+		},
+		"Neg": func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar) {
+			return c.Clone().Neg(a), c.Clone().Neg(ai)
+		},
+		"Inv": func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar) {
+			return c.Clone().Inv(b), c.Clone().Inv(bi)
+		},
+		"Set": func(c, a, b *Int256, ai, bi *Int) (kyber.Scalar, kyber.Scalar) {
+			return c.Clone().Set(a), c.Clone().Set(ai)
+		},
+	}
+	for name, op := range ops {
+		want, got := op(NewInt256(0, m), a, b, ai, bi)
+		assert.True(t, want.Equal(got), name)
+		// Uninitialized targets receive the modulus of the Int.
+		_, got = op(new(Int256), a, b, ai, bi)
+		assert.True(t, want.Equal(got), name)
+	}
+
+	assert.True(t, a.Equal(ai))
+	assert.False(t, a.Equal(bi))
+	assert.False(t, a.Equal(NewInt(x, elliptic.P256().Params().P)))
+	assert.Panics(t, func() { a.Add(a, NewInt(y, elliptic.P256().Params().P)) })
+}
+
+func TestInt256Allocs(t *testing.T) {
+	m := NewModulus256(elliptic.P256().Params().N)
+	a := NewInt256(0, m).Pick(random.New())
+	b := NewInt256(0, m).Pick(random.New())
+	c := NewInt256(0, m)
+	buf := make([]byte, 0, 32)
+	allocs := testing.AllocsPerRun(10, func() {
+		c.Mul(a, b)
+		c.Add(c, a)
+		c.Sub(c, b)
+		c.Div(c, b)
+		c.AppendBinary(buf)
+	})
+	assert.Equal(t, 0.0, allocs)
+}
+
+func BenchmarkInt256Mul(b *testing.B) {
+	m := NewModulus256(elliptic.P256().Params().N)
+	x := NewInt256(0, m).Pick(random.New())
+	y := NewInt256(0, m).Pick(random.New())
+	for i := 0; i < b.N; i++ {
+		x.Mul(x, y)
+	}
+}
+
+func BenchmarkInt256Inv(b *testing.B) {
+	m := NewModulus256(elliptic.P256().Params().N)
+	x := NewInt256(0, m).Pick(random.New())
+	for i := 0; i < b.N; i++ {
+		x.Inv(x)
+	}
+}
+
+func BenchmarkIntMul(b *testing.B) {
+	M := elliptic.P256().Params().N
+	x := NewInt64(0, M).Pick(random.New())
+	y := NewInt64(0, M).Pick(random.New())
+	for i := 0; i < b.N; i++ {
+		x.Mul(x, y)
+	}
+}
+
+func BenchmarkIntInv(b *testing.B) {
+	M := elliptic.P256().Params().N
+	x := NewInt64(0, M).Pick(random.New())
+	for i := 0; i < b.N; i++ {
+		x.Inv(x)
+	}
+}
@@ -65,6 +65,32 @@ func TestIntEndianBytes(t *testing.T) {
 	assert.NotPanics(t, func() { i.LittleEndian(2, 2) })
 }
 
+func TestIntAppendBinary(t *testing.T) {
+	modulo := new(big.Int).Lsh(big.NewInt(1), 130)
+	modulo.Sub(modulo, big.NewInt(5))
+	for _, v := range []int64{0, 1, 0x1234, -1} {
+		for _, bo := range []ByteOrder{BigEndian, LittleEndian} {
+			i := NewInt64(v, modulo)
+			i.BO = bo
+			want := make([]byte, i.MarshalSize())
+			b := i.V.Bytes()
+			copy(want[len(want)-len(b):], b)
+			if bo == LittleEndian {
+				want = reverse(want, want)
+			}
+
+			buf := []byte{0xff, 0xff, 0xff, 0xff}
+			got, err := i.AppendBinary(buf[:1])
+			assert.Nil(t, err)
+			assert.Equal(t, append([]byte{0xff}, want...), got)
+
+			m, err := i.MarshalBinary()
+			assert.Nil(t, err)
+			assert.Equal(t, want, m)
+		}
+	}
+}
+
 func TestInits(t *testing.T) {
 	i1 := NewInt64(int64(65500), big.NewInt(65535))
 	i2 := NewInt(&i1.V, i1.M)
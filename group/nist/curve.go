@@ -6,10 +6,12 @@ import (
 	"errors"
 	"io"
 	"math/big"
+	"time"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
 	"go.dedis.ch/kyber/v3/group/mod"
+	"go.dedis.ch/kyber/v3/util/metrics"
 	"go.dedis.ch/kyber/v3/util/random"
 )
 
@@ -158,13 +160,27 @@ func (p *curvePoint) Neg(a kyber.Point) kyber.Point {
 	return p.Mul(s, a).(*curvePoint)
 }
 
+var curveMulCounter = metrics.NewCounter("nist.Curve.Mul")
+
 func (p *curvePoint) Mul(s kyber.Scalar, b kyber.Point) kyber.Point {
-	cs := s.(*mod.Int)
+	if metrics.Enabled {
+		defer curveMulCounter.Since(time.Now())
+	}
+	var k []byte
+	switch cs := s.(type) {
+	case *mod.Int256:
+		var buf [32]byte
+		k, _ = cs.AppendBinary(buf[:0])
+	case *mod.Int:
+		k = cs.V.Bytes()
+	default:
+		panic("nist: unsupported scalar type")
+	}
 	if b != nil {
 		cb := b.(*curvePoint)
-		p.x, p.y = p.c.ScalarMult(cb.x, cb.y, cs.V.Bytes())
+		p.x, p.y = p.c.ScalarMult(cb.x, cb.y, k)
 	} else {
-		p.x, p.y = p.c.ScalarBaseMult(cs.V.Bytes())
+		p.x, p.y = p.c.ScalarBaseMult(k)
 	}
 	return p
 }
@@ -218,6 +234,7 @@ type curve struct {
 	elliptic.Curve
 	curveOps
 	p *elliptic.CurveParams
+	n *mod.Modulus256 // Montgomery constants of the scalars, modulo p.N
 }
 
 // Return the number of bytes in the encoding of a Scalar for this curve.
@@ -226,8 +243,12 @@ func (c *curve) ScalarLen() int { return (c.p.N.BitLen() + 7) / 8 }
 // Create a Scalar associated with this curve. The scalars created by
 // this package implement kyber.Scalar's SetBytes method, interpreting
 // the bytes as a big-endian integer, so as to be compatible with the
-// Go standard library's big.Int type.
+// Go standard library's big.Int type. They are mod.Int256 for the orders
+// below 2^256, and mod.Int otherwise.
 func (c *curve) Scalar() kyber.Scalar {
+	if c.n != nil {
+		return mod.NewInt256(0, c.n)
+	}
 	return mod.NewInt64(0, c.p.N)
 }
 
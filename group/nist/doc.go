@@ -1,3 +1,5 @@
 // Package nist implements cryptographic groups and ciphersuites
 // based on the NIST standards, using Go's built-in crypto library.
+//
+// The scalars of P-256 are mod.Int256 rather than mod.Int, see package mod.
 package nist
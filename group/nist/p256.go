@@ -3,6 +3,8 @@ package nist
 import (
 	"crypto/elliptic"
 	"math/big"
+
+	"go.dedis.ch/kyber/v3/group/mod"
 )
 
 // P256 implements the kyber.Group interface
@@ -71,6 +73,7 @@ func (curve *p256) sqrt(c *big.Int) *big.Int {
 func (curve *p256) Init() curve {
 	curve.curve.Curve = elliptic.P256()
 	curve.p = curve.Params()
+	curve.n = mod.NewModulus256(curve.p.N)
 	curve.curveOps = curve
 	return curve.curve
 }
@@ -2,7 +2,6 @@ package nist
 
 import (
 	"crypto/cipher"
-	"crypto/sha256"
 	"hash"
 	"io"
 	"math/big"
@@ -11,6 +10,7 @@ import (
 	"go.dedis.ch/fixbuf"
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
+	"go.dedis.ch/kyber/v3/util/hashpool"
 	"go.dedis.ch/kyber/v3/util/random"
 	"go.dedis.ch/kyber/v3/xof/blake2xb"
 )
@@ -20,14 +20,26 @@ type QrSuite struct {
 	ResidueGroup
 }
 
-// Hash returns the instance associated with the suite
+// Hash returns a SHA-256 hash, reusing one given back to PutHash if there is
+// any.
 func (s QrSuite) Hash() hash.Hash {
-	return sha256.New()
+	return hashpool.SHA256()
 }
 
-// XOF creates the XOF associated with the suite
+// PutHash gives back h, which must no longer be used, for Hash to reuse.
+func (s QrSuite) PutHash(h hash.Hash) {
+	hashpool.Put(h)
+}
+
+// XOF returns an XOF implemented with Blake2b, reusing one given back to
+// PutXOF if there is any.
 func (s QrSuite) XOF(key []byte) kyber.XOF {
-	return blake2xb.New(key)
+	return blake2xb.Get(key)
+}
+
+// PutXOF gives back x, which must no longer be used, for XOF to reuse.
+func (s QrSuite) PutXOF(x kyber.XOF) {
+	blake2xb.Put(x)
 }
 
 // RandomStream returns a cipher.Stream that returns a key stream
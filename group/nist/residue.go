@@ -7,10 +7,12 @@ import (
 	"fmt"
 	"io"
 	"math/big"
+	"time"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/internal/marshalling"
 	"go.dedis.ch/kyber/v3/group/mod"
+	"go.dedis.ch/kyber/v3/util/metrics"
 	"go.dedis.ch/kyber/v3/util/random"
 )
 
@@ -127,10 +129,15 @@ func (p *residuePoint) Neg(a kyber.Point) kyber.Point {
 	return p
 }
 
+var residueMulCounter = metrics.NewCounter("nist.Residue.Mul")
+
 func (p *residuePoint) Mul(s kyber.Scalar, b kyber.Point) kyber.Point {
 	if b == nil {
 		return p.Base().Mul(s, p)
 	}
+	if metrics.Enabled {
+		defer residueMulCounter.Since(time.Now())
+	}
 	// to protect against golang/go#22830
 	var tmp big.Int
 	tmp.Exp(&b.(*residuePoint).Int, &s.(*mod.Int).V, p.g.P)
@@ -6,3 +6,11 @@ import "hash"
 type HashFactory interface {
 	Hash() hash.Hash
 }
+
+// A HashPool is a HashFactory that can reuse the hashes it returned. Once a
+// caller is done with a hash of Hash, it may give it back with PutHash, and
+// must not use it afterwards.
+type HashPool interface {
+	HashFactory
+	PutHash(hash.Hash)
+}
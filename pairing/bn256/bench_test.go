@@ -0,0 +1,206 @@
+package bn256
+
+import (
+	"flag"
+	"testing"
+	"time"
+
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/random"
+)
+
+// The benchmarks below cover every layer of the pairing, from the base field
+// to the encodings of the groups. They all report allocations. Run them with
+// the generic build tag to measure the pure Go field arithmetic, and with
+// -bn256.mul to select the multiplication of the amd64 assembly, e.g.
+//
+//	go test -run XXX -bench . -bn256.mul=mul -bn256.ghz=3.5
+var (
+	benchGHz = flag.Float64("bn256.ghz", 0, "also report cycles/op for a CPU running at this many GHz")
+	benchMul = flag.String("bn256.mul", "", "amd64 field multiplication to benchmark: mul, bmi2 or adx")
+)
+
+// bench runs f b.N times, after selecting the multiplication requested with
+// -bn256.mul, and reports allocations and, given -bn256.ghz, cycles per op.
+func bench(b *testing.B, f func()) {
+	defer setMulPath(b)()
+	b.ReportAllocs()
+	b.ResetTimer()
+	start := time.Now()
+	for i := 0; i < b.N; i++ {
+		f()
+	}
+	elapsed := time.Since(start)
+	b.StopTimer()
+	if *benchGHz > 0 {
+		reportCycles(b, float64(elapsed.Nanoseconds())**benchGHz/float64(b.N))
+	}
+}
+
+func randomGFp12() *gfP12 {
+	return &gfP12{*randomGFp6(), *randomGFp6()}
+}
+
+func randomCurvePoint() *curvePoint {
+	c := &curvePoint{}
+	c.Mul(curveGen, random.Int(Order, random.New()))
+	return c
+}
+
+func randomG2Point() *twistPoint {
+	c := &twistPoint{}
+	c.Mul(twistGen, random.Int(Order, random.New()))
+	return c
+}
+
+func BenchmarkGFp(b *testing.B) {
+	x, y, z := randomGFp(), randomGFp(), &gfP{}
+	b.Run("Add", func(b *testing.B) { bench(b, func() { gfpAdd(z, x, y) }) })
+	b.Run("Sub", func(b *testing.B) { bench(b, func() { gfpSub(z, x, y) }) })
+	b.Run("Neg", func(b *testing.B) { bench(b, func() { gfpNeg(z, x) }) })
+	b.Run("Mul", func(b *testing.B) { bench(b, func() { gfpMul(z, x, y) }) })
+	b.Run("Sqr", func(b *testing.B) { bench(b, func() { gfpSqr(z, x) }) })
+	b.Run("Invert", func(b *testing.B) { bench(b, func() { z.Invert(x) }) })
+	b.Run("Sqrt", func(b *testing.B) { bench(b, func() { z.Sqrt(x) }) })
+
+	xs, ys, zs := make([]gfP, 64), make([]gfP, 64), make([]gfP, 64)
+	for i := range xs {
+		xs[i], ys[i] = *randomGFp(), *randomGFp()
+	}
+	b.Run("MulVec64", func(b *testing.B) { bench(b, func() { gfpMulVec(zs, xs, ys) }) })
+}
+
+func BenchmarkGFp2(b *testing.B) {
+	x, y, z := randomGFp2(), randomGFp2(), &gfP2{}
+	b.Run("Add", func(b *testing.B) { bench(b, func() { z.Add(x, y) }) })
+	b.Run("Mul", func(b *testing.B) { bench(b, func() { z.Mul(x, y) }) })
+	b.Run("MulXi", func(b *testing.B) { bench(b, func() { z.MulXi(x) }) })
+	b.Run("Square", func(b *testing.B) { bench(b, func() { z.Square(x) }) })
+	b.Run("Invert", func(b *testing.B) { bench(b, func() { z.Invert(x) }) })
+}
+
+func BenchmarkGFp6(b *testing.B) {
+	x, y, z := randomGFp6(), randomGFp6(), &gfP6{}
+	b.Run("Mul", func(b *testing.B) { bench(b, func() { z.Mul(x, y) }) })
+	b.Run("Square", func(b *testing.B) { bench(b, func() { z.Square(x) }) })
+	b.Run("Invert", func(b *testing.B) { bench(b, func() { z.Invert(x) }) })
+}
+
+func BenchmarkGFp12(b *testing.B) {
+	x, y, z := randomGFp12(), randomGFp12(), &gfP12{}
+	// Elements of GT, for the squarings of the cyclotomic subgroup.
+	gt := finalExponentiation(&gfP12{}, x)
+	b.Run("Mul", func(b *testing.B) { bench(b, func() { z.Mul(x, y) }) })
+	b.Run("Square", func(b *testing.B) { bench(b, func() { z.Square(x) }) })
+	b.Run("CyclotomicSquare", func(b *testing.B) { bench(b, func() { z.CyclotomicSquare(gt) }) })
+	b.Run("Invert", func(b *testing.B) { bench(b, func() { z.Invert(x) }) })
+	b.Run("Frobenius", func(b *testing.B) { bench(b, func() { z.Frobenius(x) }) })
+}
+
+func BenchmarkCurvePoint(b *testing.B) {
+	x, y, z := randomCurvePoint(), randomCurvePoint(), &curvePoint{}
+	k := random.Int(Order, random.New())
+	b.Run("Add", func(b *testing.B) { bench(b, func() { z.Add(x, y) }) })
+	b.Run("Double", func(b *testing.B) { bench(b, func() { z.Double(x) }) })
+	b.Run("Mul", func(b *testing.B) { bench(b, func() { z.Mul(x, k) }) })
+	b.Run("MulVartime", func(b *testing.B) { bench(b, func() { z.mulVartime(x, k) }) })
+	b.Run("MakeAffine", func(b *testing.B) {
+		bench(b, func() {
+			z.Set(x)
+			z.MakeAffine()
+		})
+	})
+
+	ps, work, batch := make([]curvePoint, 64), make([]curvePoint, 64), make([]*curvePoint, 64)
+	ps[0].Add(x, y)
+	for i := range ps {
+		if i > 0 {
+			ps[i].Add(&ps[i-1], y)
+		}
+		batch[i] = &work[i]
+	}
+	b.Run("BatchMakeAffine64", func(b *testing.B) {
+		bench(b, func() {
+			copy(work, ps)
+			curveBatchMakeAffine(batch)
+		})
+	})
+}
+
+func BenchmarkTwistPoint(b *testing.B) {
+	x, y, z := randomG2Point(), randomG2Point(), &twistPoint{}
+	k := random.Int(Order, random.New())
+	b.Run("Add", func(b *testing.B) { bench(b, func() { z.Add(x, y) }) })
+	b.Run("Double", func(b *testing.B) { bench(b, func() { z.Double(x) }) })
+	b.Run("Mul", func(b *testing.B) { bench(b, func() { z.Mul(x, k) }) })
+	b.Run("MulVartime", func(b *testing.B) { bench(b, func() { z.mulVartime(x, k) }) })
+	b.Run("IsInSubgroup", func(b *testing.B) { bench(b, func() { x.IsInSubgroup() }) })
+}
+
+func BenchmarkPairing(b *testing.B) {
+	q := randomG2Point()
+	ps := []curvePoint{*randomCurvePoint()}
+	ps[0].MakeAffine()
+	lines := [][]lineCoeffs{prepareLines(q)}
+	e, f := &gfP12{}, multiMiller(&gfP12{}, lines, ps)
+
+	b.Run("Lines", func(b *testing.B) { bench(b, func() { prepareLines(q) }) })
+	b.Run("Miller", func(b *testing.B) { bench(b, func() { multiMiller(e, lines, ps) }) })
+	b.Run("FinalExponentiation", func(b *testing.B) { bench(b, func() { finalExponentiation(e, f) }) })
+
+	suite := NewSuite()
+	p1 := suite.G1().Point().Pick(random.New())
+	p2 := suite.G2().Point().Pick(random.New())
+	prepared := NewPreparedG2(p2)
+	p1s := []kyber.Point{p1, suite.G1().Point().Neg(p1)}
+	p2s := []kyber.Point{p2, p2}
+	b.Run("Pair", func(b *testing.B) { bench(b, func() { suite.Pair(p1, p2) }) })
+	b.Run("PairPrepared", func(b *testing.B) { bench(b, func() { suite.Pair(p1, prepared) }) })
+	b.Run("PairingCheck2", func(b *testing.B) { bench(b, func() { suite.PairingCheck(p1s, p2s) }) })
+}
+
+func BenchmarkHash(b *testing.B) {
+	msg := []byte("Hello, BN256!")
+	dst := []byte("BN256G1_XMD:SHA-256_SVDW_RO_")
+	suite := NewSuite()
+	c := new(curvePoint)
+	b.Run("G1", func(b *testing.B) { bench(b, func() { hashToPoint(c, msg) }) })
+	msgs := make([][]byte, 64)
+	for i := range msgs {
+		msgs[i] = append([]byte{byte(i)}, msg...)
+	}
+	g1 := suite.G1().(*groupG1)
+	b.Run("G1Batch64", func(b *testing.B) { bench(b, func() { g1.HashBatch(msgs) }) })
+	b.Run("HashToCurve", func(b *testing.B) {
+		bench(b, func() { suite.G1().Point().(*pointG1).HashToCurve(msg, dst) })
+	})
+}
+
+func BenchmarkMarshal(b *testing.B) {
+	suite, compressed := NewSuite(), NewSuiteCompressed()
+	for _, g := range []struct {
+		name  string
+		group kyber.Group
+	}{
+		{"G1", suite.G1()},
+		{"G2", suite.G2()},
+		{"GT", suite.GT()},
+		{"G1Compressed", compressed.G1()},
+		{"G2Compressed", compressed.G2()},
+	} {
+		p := g.group.Point().Pick(random.New())
+		buf, err := p.MarshalBinary()
+		if err != nil {
+			b.Fatal(err)
+		}
+		q := g.group.Point()
+		b.Run(g.name+"/Marshal", func(b *testing.B) { bench(b, func() { p.MarshalBinary() }) })
+		b.Run(g.name+"/Unmarshal", func(b *testing.B) {
+			bench(b, func() {
+				if err := q.UnmarshalBinary(buf); err != nil {
+					b.Fatal(err)
+				}
+			})
+		})
+	}
+}
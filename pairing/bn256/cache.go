@@ -0,0 +1,93 @@
+package bn256
+
+import (
+	"container/list"
+	"errors"
+	"sync"
+
+	"go.dedis.ch/kyber/v3"
+)
+
+// PointCache is a bounded cache of decoded points of G1 or G2, keyed by their
+// encoding. Decoding a point checks that it is on the curve and, for G2, in
+// the subgroup, which is much slower than a lookup; a PointCache pays off when
+// the same points, e.g. the public keys of a committee, are decoded again and
+// again. When it is full, the least recently used point is evicted. A
+// PointCache is safe for concurrent use.
+type PointCache struct {
+	group kyber.Group
+	size  int
+
+	mu      sync.Mutex
+	entries map[string]*list.Element
+	lru     list.List // of *pointCacheEntry, most recently used first
+}
+
+type pointCacheEntry struct {
+	key   string
+	point kyber.Point
+}
+
+// NewPointCache returns a cache of at most size points of the group g, which
+// must be the G1 or G2 group of a bn256 suite.
+func NewPointCache(g kyber.Group, size int) *PointCache {
+	switch g.Point().(type) {
+	case *pointG1, *pointG2:
+	default:
+		panic("bn256: PointCache needs the group G1 or G2")
+	}
+	if size < 1 {
+		panic("bn256: PointCache needs a positive size")
+	}
+	return &PointCache{
+		group:   g,
+		size:    size,
+		entries: make(map[string]*list.Element, size),
+	}
+}
+
+// UnmarshalBinary sets p, a point of the group of the cache, to the point
+// encoded in buf like p.UnmarshalBinary, but only decodes and checks buf if it
+// is not in the cache yet.
+func (c *PointCache) UnmarshalBinary(p kyber.Point, buf []byte) error {
+	size := p.MarshalSize()
+	if len(buf) < size {
+		return errors.New("bn256: not enough data")
+	}
+	key := string(buf[:size])
+
+	c.mu.Lock()
+	if e, ok := c.entries[key]; ok {
+		c.lru.MoveToFront(e)
+		p.Set(e.Value.(*pointCacheEntry).point)
+		c.mu.Unlock()
+		return nil
+	}
+	c.mu.Unlock()
+
+	q := c.group.Point()
+	if err := q.UnmarshalBinary(buf); err != nil {
+		return err
+	}
+	p.Set(q)
+
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if _, ok := c.entries[key]; ok {
+		return nil
+	}
+	if c.lru.Len() >= c.size {
+		oldest := c.lru.Back()
+		delete(c.entries, oldest.Value.(*pointCacheEntry).key)
+		c.lru.Remove(oldest)
+	}
+	c.entries[key] = c.lru.PushFront(&pointCacheEntry{key, q})
+	return nil
+}
+
+// Len returns the number of points in the cache.
+func (c *PointCache) Len() int {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	return c.lru.Len()
+}
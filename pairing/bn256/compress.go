@@ -0,0 +1,151 @@
+package bn256
+
+import "errors"
+
+// This file contains the compressed encodings of the points of G₁ and G₂. A
+// point is its x coordinate, which determines y up to its sign, preceded by a
+// byte: 0x02 or 0x03 for a y whose sgn0 as in RFC 9380 is 0 or 1, and 0x00
+// for the point at infinity, whose x is all zeros. Unlike for curves whose
+// prime leaves the top bits of the coordinates free, this needs the extra
+// byte since p > 2^255.
+
+const (
+	compressedInfinity = 0x00
+	compressedEven     = 0x02
+	compressedOdd      = 0x03
+)
+
+// gfpFromBytes sets e to the canonical big-endian encoding of a field element
+// in Montgomery form, and returns false if it isn't below p.
+func gfpFromBytes(e *gfP, in []byte) bool {
+	e.Unmarshal(in)
+	for i := len(e) - 1; i >= 0; i-- {
+		if e[i] != p2[i] {
+			if e[i] > p2[i] {
+				return false
+			}
+			montEncode(e, e)
+			return true
+		}
+	}
+	return false
+}
+
+// gfp2Sgn0 returns sgn0 of e as in RFC 9380, section 4.1: the parity of its
+// real part, or that of its imaginary part if the real part is zero.
+func gfp2Sgn0(e *gfP2) uint64 {
+	if e.y == (gfP{0}) {
+		return gfpSgn0(&e.x)
+	}
+	return gfpSgn0(&e.y)
+}
+
+// marshalCurveCompressed writes the compressed encoding of the affine c to
+// out, which has 1+n bytes for n bytes per coordinate.
+func marshalCurveCompressed(out []byte, n int, c *curvePoint) {
+	if c.IsInfinity() {
+		out[0] = compressedInfinity
+		zeroBytes(out[1 : 1+n])
+		return
+	}
+	out[0] = compressedEven | byte(gfpSgn0(&c.y))
+	tmp := &gfP{}
+	montDecode(tmp, &c.x)
+	tmp.Marshal(out[1:])
+}
+
+// unmarshalCurveCompressed sets c to the point encoded in buf by
+// marshalCurveCompressed. The point is on the curve, and so in G₁.
+func unmarshalCurveCompressed(c *curvePoint, n int, buf []byte) error {
+	switch buf[0] {
+	case compressedInfinity:
+		for _, b := range buf[1 : 1+n] {
+			if b != 0 {
+				return errors.New("bn256.G1: malformed point")
+			}
+		}
+		c.SetInfinity()
+		return nil
+	case compressedEven, compressedOdd:
+	default:
+		return errors.New("bn256.G1: malformed point")
+	}
+
+	if !gfpFromBytes(&c.x, buf[1:1+n]) {
+		return errors.New("bn256.G1: malformed point")
+	}
+	// y² = x³+3
+	y2 := &gfP{}
+	gfpSqr(y2, &c.x)
+	gfpMul(y2, y2, &c.x)
+	gfpAdd(y2, y2, curveB)
+	if !c.y.Sqrt(y2) {
+		return errors.New("bn256.G1: malformed point")
+	}
+	if gfpSgn0(&c.y) != uint64(buf[0]&1) {
+		if c.y == (gfP{0}) {
+			return errors.New("bn256.G1: malformed point")
+		}
+		gfpNeg(&c.y, &c.y)
+	}
+	c.z = *newGFp(1)
+	c.t = *newGFp(1)
+	return nil
+}
+
+// marshalTwistCompressed writes the compressed encoding of the affine c to
+// out, which has 1+2n bytes for n bytes per coordinate of GF(p).
+func marshalTwistCompressed(out []byte, n int, c *twistPoint) {
+	if c.IsInfinity() {
+		out[0] = compressedInfinity
+		zeroBytes(out[1 : 1+2*n])
+		return
+	}
+	out[0] = compressedEven | byte(gfp2Sgn0(&c.y))
+	tmp := &gfP{}
+	montDecode(tmp, &c.x.x)
+	tmp.Marshal(out[1:])
+	montDecode(tmp, &c.x.y)
+	tmp.Marshal(out[1+n:])
+}
+
+// unmarshalTwistCompressed sets c to the point encoded in buf by
+// marshalTwistCompressed, and checks that it is in G₂.
+func unmarshalTwistCompressed(c *twistPoint, n int, buf []byte) error {
+	switch buf[0] {
+	case compressedInfinity:
+		for _, b := range buf[1 : 1+2*n] {
+			if b != 0 {
+				return errors.New("bn256.G2: malformed point")
+			}
+		}
+		c.SetInfinity()
+		return nil
+	case compressedEven, compressedOdd:
+	default:
+		return errors.New("bn256.G2: malformed point")
+	}
+
+	if !gfpFromBytes(&c.x.x, buf[1:1+n]) || !gfpFromBytes(&c.x.y, buf[1+n:1+2*n]) {
+		return errors.New("bn256.G2: malformed point")
+	}
+	// y² = x³+3/ξ
+	y2 := &gfP2{}
+	y2.Square(&c.x).Mul(y2, &c.x).Add(y2, twistB)
+	if !c.y.Sqrt(y2) {
+		return errors.New("bn256.G2: malformed point")
+	}
+	if gfp2Sgn0(&c.y) != uint64(buf[0]&1) {
+		if c.y.IsZero() {
+			return errors.New("bn256.G2: malformed point")
+		}
+		c.y.Neg(&c.y)
+	}
+	c.z.SetOne()
+	c.t.SetOne()
+
+	if !c.IsInSubgroup() {
+		return errors.New("bn256.G2: point is not in G2")
+	}
+	return nil
+}
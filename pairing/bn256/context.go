@@ -0,0 +1,182 @@
+package bn256
+
+import (
+	"sync"
+	"time"
+
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/metrics"
+)
+
+// PairingContext holds the scratch space of pairings: the line functions of
+// G2 points that are not prepared and the G1 points in affine form. Once it
+// has grown to the number of pairs in use, pairings computed with it do not
+// allocate at all. A PairingContext must not be used concurrently; the zero
+// value is ready to use.
+type PairingContext struct {
+	lines  [][]lineCoeffs // the lines of the pairs, some of them in bufs
+	bufs   [][]lineCoeffs // line buffers for G2 points that are not prepared
+	nbufs  int            // number of bufs in use
+	affine []curvePoint   // the G1 points of the pairs, in affine form
+}
+
+// NewPairingContext returns a new, empty PairingContext.
+func NewPairingContext() *PairingContext {
+	return &PairingContext{}
+}
+
+var (
+	pairCounter         = metrics.NewCounter("bn256.Pair")
+	multiPairCounter    = metrics.NewCounter("bn256.MultiPair")
+	pairingCheckCounter = metrics.NewCounter("bn256.PairingCheck")
+	millerCounter       = metrics.NewCounter("bn256.Miller")
+	// millerPairsCounter counts the pairs of all Miller loops.
+	millerPairsCounter = metrics.NewCounter("bn256.Miller.Pairs")
+)
+
+// pairingContexts are the contexts used by the methods of pointGT, so that
+// they do not allocate in steady state either.
+var pairingContexts = sync.Pool{
+	New: func() interface{} { return NewPairingContext() },
+}
+
+// Pair sets gt to the pairing e(p1, p2) of p1 in G1 and p2 in G2, which may be
+// prepared, and returns gt.
+func (c *PairingContext) Pair(gt, p1, p2 kyber.Point) kyber.Point {
+	if metrics.Enabled {
+		defer pairCounter.Since(time.Now())
+	}
+	c.reset()
+	c.add(p1, p2)
+	c.finalize(gt.(*pointGT))
+	return gt
+}
+
+// MultiPair sets gt to the product of the pairings e(p1s[i], p2s[i]) and
+// returns gt, see pointGT.MultiPair.
+func (c *PairingContext) MultiPair(gt kyber.Point, p1s, p2s []kyber.Point) kyber.Point {
+	if len(p1s) != len(p2s) {
+		panic("bn256.GT: mismatched number of G1 and G2 points")
+	}
+	if metrics.Enabled {
+		defer multiPairCounter.Since(time.Now())
+	}
+
+	c.reset()
+	for i := range p1s {
+		c.add(p1s[i], p2s[i])
+	}
+	c.finalize(gt.(*pointGT))
+	return gt
+}
+
+// PairingCheck returns whether the product of the pairings e(p1s[i], p2s[i])
+// is the identity of GT.
+func (c *PairingContext) PairingCheck(p1s, p2s []kyber.Point) bool {
+	if len(p1s) != len(p2s) {
+		panic("bn256.GT: mismatched number of G1 and G2 points")
+	}
+	if metrics.Enabled {
+		defer pairingCheckCounter.Since(time.Now())
+	}
+
+	c.reset()
+	for i := range p1s {
+		c.add(p1s[i], p2s[i])
+	}
+	e := &gfP12{}
+	return finalExponentiation(e, c.miller(e)).IsOne()
+}
+
+// MultiMiller sets gt to the product of the Miller loops of the pairs of
+// p1s[i] and p2s[i], without the final exponentiation, and returns gt.
+func (c *PairingContext) MultiMiller(gt kyber.Point, p1s, p2s []kyber.Point) kyber.Point {
+	if len(p1s) != len(p2s) {
+		panic("bn256.GT: mismatched number of G1 and G2 points")
+	}
+
+	c.reset()
+	for i := range p1s {
+		c.add(p1s[i], p2s[i])
+	}
+	c.millerGT(gt.(*pointGT))
+	return gt
+}
+
+// Miller sets gt to the Miller loop of p1 and p2, without the final
+// exponentiation, and returns gt.
+func (c *PairingContext) Miller(gt, p1, p2 kyber.Point) kyber.Point {
+	c.reset()
+	c.add(p1, p2)
+	c.millerGT(gt.(*pointGT))
+	return gt
+}
+
+// finalize sets gt to the final exponentiation of the Miller loop of the
+// added pairs.
+func (c *PairingContext) finalize(gt *pointGT) {
+	finalExponentiation(c.miller(gt.g), gt.g)
+	gt.cyclotomic = true
+}
+
+// millerGT sets gt to the Miller loop of the added pairs, which is not in
+// the cyclotomic subgroup until it is finalized.
+func (c *PairingContext) millerGT(gt *pointGT) {
+	c.miller(gt.g)
+	gt.cyclotomic = false
+}
+
+func (c *PairingContext) reset() {
+	// Drop the references to the lines of prepared points.
+	for i := range c.lines {
+		c.lines[i] = nil
+	}
+	c.lines = c.lines[:0]
+	c.affine = c.affine[:0]
+	c.nbufs = 0
+}
+
+// add adds the pair of p1 in G1 and p2 in G2 to the pairs of c, unless one of
+// them is the point at infinity, whose pairings are one.
+func (c *PairingContext) add(p1, p2 kyber.Point) {
+	a := p1.(*pointG1).g
+	if a.IsInfinity() {
+		return
+	}
+
+	var lines []lineCoeffs
+	if pp, ok := p2.(*PreparedG2); ok {
+		lines = pp.lines
+	} else if g := p2.(*pointG2).g; g.IsInfinity() {
+		lines = nil
+	} else if *g == *twistGen {
+		lines = g2Lines(p2)
+	} else {
+		if c.nbufs == len(c.bufs) {
+			c.bufs = append(c.bufs, make([]lineCoeffs, 0, numLines))
+		}
+		lines = appendLines(c.bufs[c.nbufs][:0], g)
+		c.bufs[c.nbufs] = lines
+		c.nbufs++
+	}
+	if lines == nil {
+		return
+	}
+
+	c.lines = append(c.lines, lines)
+	c.affine = append(c.affine, *a)
+	c.affine[len(c.affine)-1].MakeAffine()
+}
+
+// miller sets e to the product of the Miller loops of the pairs of c and
+// returns e.
+func (c *PairingContext) miller(e *gfP12) *gfP12 {
+	if len(c.lines) == 0 {
+		return e.SetOne()
+	}
+	if metrics.Enabled {
+		millerPairsCounter.Add(uint64(len(c.lines)))
+		defer millerCounter.Since(time.Now())
+	}
+	return multiMiller(e, c.lines, c.affine)
+}
@@ -45,8 +45,8 @@ func (c *curvePoint) IsOnCurve() bool {
 	}
 
 	y2, x3 := &gfP{}, &gfP{}
-	gfpMul(y2, &c.y, &c.y)
-	gfpMul(x3, &c.x, &c.x)
+	gfpSqr(y2, &c.y)
+	gfpSqr(x3, &c.x)
 	gfpMul(x3, x3, &c.x)
 	gfpAdd(x3, x3, curveB)
 
@@ -64,6 +64,29 @@ func (c *curvePoint) IsInfinity() bool {
 	return c.z == gfP{0}
 }
 
+// Equal returns whether c and b are the same point. Their Jacobian
+// coordinates are compared without MakeAffine's inversions: they are the same
+// point if x₁·z₂² = x₂·z₁² and y₁·z₂³ = y₂·z₁³.
+func (c *curvePoint) Equal(b *curvePoint) bool {
+	if inf1, inf2 := c.IsInfinity(), b.IsInfinity(); inf1 || inf2 {
+		return inf1 == inf2
+	}
+
+	zz1, zz2, l, r := &gfP{}, &gfP{}, &gfP{}, &gfP{}
+	gfpSqr(zz1, &c.z)
+	gfpSqr(zz2, &b.z)
+	gfpMul(l, &c.x, zz2)
+	gfpMul(r, &b.x, zz1)
+	if *l != *r {
+		return false
+	}
+	gfpMul(zz2, zz2, &b.z)
+	gfpMul(zz1, zz1, &c.z)
+	gfpMul(l, &c.y, zz2)
+	gfpMul(r, &b.y, zz1)
+	return *l == *r
+}
+
 func (c *curvePoint) Add(a, b *curvePoint) {
 	if a.IsInfinity() {
 		c.Set(b)
@@ -80,8 +103,8 @@ func (c *curvePoint) Add(a, b *curvePoint) {
 	// by [u1:s1:z1·z2] and [u2:s2:z1·z2]
 	// where u1 = x1·z2², s1 = y1·z2³ and u1 = x2·z1², s2 = y2·z1³
 	z12, z22 := &gfP{}, &gfP{}
-	gfpMul(z12, &a.z, &a.z)
-	gfpMul(z22, &b.z, &b.z)
+	gfpSqr(z12, &a.z)
+	gfpSqr(z22, &b.z)
 
 	u1, u2 := &gfP{}, &gfP{}
 	gfpMul(u1, &a.x, z22)
@@ -109,7 +132,7 @@ func (c *curvePoint) Add(a, b *curvePoint) {
 	gfpAdd(t, h, h)
 	// i = 4h²
 	i := &gfP{}
-	gfpMul(i, t, t)
+	gfpSqr(i, t)
 	// j = 4h³
 	j := &gfP{}
 	gfpMul(j, h, i)
@@ -128,7 +151,7 @@ func (c *curvePoint) Add(a, b *curvePoint) {
 
 	// t4 = 4(s2-s1)²
 	t4, t6 := &gfP{}, &gfP{}
-	gfpMul(t4, r, r)
+	gfpSqr(t4, r)
 	gfpAdd(t, v, v)
 	gfpSub(t6, t4, j)
 
@@ -145,22 +168,88 @@ func (c *curvePoint) Add(a, b *curvePoint) {
 
 	// Set z = 2(u2-u1)·z1·z2 = 2h·z1·z2
 	gfpAdd(t, &a.z, &b.z) // t11
-	gfpMul(t4, t, t)      // t12
+	gfpSqr(t4, t)         // t12
 	gfpSub(t, t4, z12)    // t13
 	gfpSub(t4, t, z22)    // t14
 	gfpMul(&c.z, t4, h)
 }
 
+// addAffine sets c = a+b for an affine b, which saves the multiplications by
+// the z coordinate of b in Add.
+func (c *curvePoint) addAffine(a *curvePoint, b *curveAffine) {
+	if a.IsInfinity() {
+		c.x, c.y = b.x, b.y
+		c.z, c.t = *newGFp(1), *newGFp(1)
+		return
+	}
+
+	// See http://hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/addition/madd-2007-bl.op3
+	z12 := &gfP{}
+	gfpSqr(z12, &a.z)
+
+	u2, t, s2 := &gfP{}, &gfP{}, &gfP{}
+	gfpMul(u2, &b.x, z12)
+	gfpMul(t, &a.z, z12)
+	gfpMul(s2, &b.y, t)
+
+	h := &gfP{}
+	gfpSub(h, u2, &a.x)
+	xEqual := *h == gfP{0}
+
+	hh, i, j := &gfP{}, &gfP{}, &gfP{}
+	gfpSqr(hh, h)
+	gfpAdd(t, hh, hh)
+	gfpAdd(i, t, t)
+	gfpMul(j, h, i)
+
+	gfpSub(t, s2, &a.y)
+	yEqual := *t == gfP{0}
+	if xEqual && yEqual {
+		c.Double(a)
+		return
+	}
+	r := &gfP{}
+	gfpAdd(r, t, t)
+
+	v := &gfP{}
+	gfpMul(v, &a.x, i)
+
+	// z = (z1+h)² - z1² - h² = 2·z1·h
+	z := &gfP{}
+	gfpAdd(t, &a.z, h)
+	gfpSqr(z, t)
+	gfpSub(t, z, z12)
+	gfpSub(z, t, hh)
+
+	// x = r² - j - 2v and y = r(v-x) - 2·y1·j
+	t4, t6 := &gfP{}, &gfP{}
+	gfpSqr(t4, r)
+	gfpAdd(t, v, v)
+	gfpSub(t6, t4, j)
+	gfpSub(&c.x, t6, t)
+
+	gfpMul(t4, &a.y, j)
+	gfpAdd(t6, t4, t4)
+	gfpSub(t, v, &c.x)
+	gfpMul(t4, r, t)
+	gfpSub(&c.y, t4, t6)
+
+	c.z.Set(z)
+}
+
 func (c *curvePoint) Double(a *curvePoint) {
 	// See http://hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/doubling/dbl-2009-l.op3
+	// z = 2·y·z is computed first, so that c may alias a.
+	yz := &gfP{}
+	gfpMul(yz, &a.y, &a.z)
 	A, B, C := &gfP{}, &gfP{}, &gfP{}
-	gfpMul(A, &a.x, &a.x)
-	gfpMul(B, &a.y, &a.y)
-	gfpMul(C, B, B)
+	gfpSqr(A, &a.x)
+	gfpSqr(B, &a.y)
+	gfpSqr(C, B)
 
 	t, t2 := &gfP{}, &gfP{}
 	gfpAdd(t, &a.x, B)
-	gfpMul(t2, t, t)
+	gfpSqr(t2, t)
 	gfpSub(t, t2, A)
 	gfpSub(t2, t, C)
 
@@ -168,7 +257,7 @@ func (c *curvePoint) Double(a *curvePoint) {
 	gfpAdd(d, t2, t2)
 	gfpAdd(t, A, A)
 	gfpAdd(e, t, A)
-	gfpMul(f, e, e)
+	gfpSqr(f, e)
 
 	gfpAdd(t, d, d)
 	gfpSub(&c.x, f, t)
@@ -180,26 +269,240 @@ func (c *curvePoint) Double(a *curvePoint) {
 	gfpMul(t2, e, &c.y)
 	gfpSub(&c.y, t2, t)
 
-	gfpMul(t, &a.y, &a.z)
-	gfpAdd(&c.z, t, t)
+	gfpAdd(&c.z, yz, yz)
 }
 
+// Mul sets c = scalar·a for a in G₁. It uses the GLV method with a regular
+// recoding of the two half-size scalars, so that the sequence of point
+// operations and table accesses doesn't depend on the scalar.
 func (c *curvePoint) Mul(a *curvePoint, scalar *big.Int) {
+	k1, k2 := glvDecompose(scalar)
+
+	// tables[0] holds the odd multiples of ±a and tables[1] those of ±φ(a),
+	// with the signs of k1 and k2.
+	var tables [2][mulTableSize]curvePoint
+	curveOddMultiples(&tables[0], a)
+	for i := range tables[1] {
+		tables[1][i].phi(&tables[0][i])
+	}
+
+	var digits [2][mulDigits]int8
+	var even [2]uint64
+	for j, k := range []*big.Int{k1, k2} {
+		neg := ctEq(k.Sign(), -1)
+		for i := range tables[j] {
+			tables[j][i].condNeg(&tables[j][i], neg)
+		}
+
+		// The recoding needs an odd scalar: add one to an even one and
+		// subtract the point again at the end.
+		h := newHalfScalar(new(big.Int).Abs(k))
+		even[j] = -(^h[0] & 1)
+		h[0] |= 1
+		digits[j] = recodeRegular(h)
+	}
+
 	sum, t := &curvePoint{}, &curvePoint{}
-	sum.SetInfinity()
+	sum.lookup(&tables[0], digits[0][mulDigits-1])
+	t.lookup(&tables[1], digits[1][mulDigits-1])
+	sum.Add(sum, t)
+
+	for i := mulDigits - 2; i >= 0; i-- {
+		for w := 0; w < mulWindow; w += 2 {
+			t.Double(sum)
+			sum.Double(t)
+		}
+		for j := range tables {
+			t.lookup(&tables[j], digits[j][i])
+			sum.Add(sum, t)
+		}
+	}
 
-	for i := scalar.BitLen(); i >= 0; i-- {
+	for j := range tables {
+		t.Neg(&tables[j][0])
+		t.Add(sum, t)
+		sum.condSet(t, even[j])
+	}
+
+	c.Set(sum)
+}
+
+// mulVartime sets c = scalar·a for a in G₁ like Mul, but in variable time.
+// Only use it on public scalars.
+func (c *curvePoint) mulVartime(a *curvePoint, scalar *big.Int) {
+	c.multiScalarMul([]*big.Int{scalar}, []*curvePoint{a})
+}
+
+// multiScalarMul sets c = Σ scalars[i]·points[i] for points in G₁, in
+// variable time. It splits every scalar with glvDecompose, and then uses
+// Straus' method for few halves and Pippenger's for many.
+func (c *curvePoint) multiScalarMul(scalars []*big.Int, points []*curvePoint) {
+	hs := make([]halfScalar, 2*len(scalars))
+	neg := make([]bool, 2*len(scalars))
+	for i, k := range scalars {
+		k1, k2 := glvDecompose(k)
+		hs[2*i] = newHalfScalar(new(big.Int).Abs(k1))
+		hs[2*i+1] = newHalfScalar(new(big.Int).Abs(k2))
+		neg[2*i], neg[2*i+1] = k1.Sign() < 0, k2.Sign() < 0
+	}
+
+	if len(hs) <= msmStrausMax {
+		tables := make([][mulTableSize]curvePoint, len(hs))
+		for i, a := range points {
+			curveOddMultiples(&tables[2*i], a)
+			for j := range tables[2*i+1] {
+				tables[2*i+1][j].phi(&tables[2*i][j])
+			}
+		}
+		for i := range tables {
+			if neg[i] {
+				for j := range tables[i] {
+					tables[i][j].Neg(&tables[i][j])
+				}
+			}
+		}
+		c.straus(hs, tables)
+		return
+	}
+
+	ps := make([]curvePoint, len(hs))
+	for i, a := range points {
+		ps[2*i].Set(a)
+		ps[2*i+1].phi(a)
+	}
+	for i := range ps {
+		if neg[i] {
+			ps[i].Neg(&ps[i])
+		}
+	}
+	c.pippenger(hs, ps)
+}
+
+// straus sets c = Σ hs[i]·Pᵢ in variable time, given the odd multiples of
+// every Pᵢ in tables, by interleaving the wNAFs of the scalars.
+func (c *curvePoint) straus(hs []halfScalar, tables [][mulTableSize]curvePoint) {
+	naf := make([][]int8, len(hs))
+	n := 0
+	for i := range hs {
+		naf[i] = recodeWNAF(hs[i])
+		if len(naf[i]) > n {
+			n = len(naf[i])
+		}
+	}
+
+	sum, t := &curvePoint{}, &curvePoint{}
+	sum.SetInfinity()
+	for i := n - 1; i >= 0; i-- {
 		t.Double(sum)
-		if scalar.Bit(i) != 0 {
-			sum.Add(t, a)
-		} else {
+		sum.Set(t)
+		for j := range naf {
+			if i >= len(naf[j]) || naf[j][i] == 0 {
+				continue
+			}
+			d := naf[j][i]
+			if d > 0 {
+				sum.Add(sum, &tables[j][d/2])
+			} else {
+				t.Neg(&tables[j][-d/2])
+				sum.Add(sum, t)
+			}
+		}
+	}
+
+	c.Set(sum)
+}
+
+// pippenger sets c = Σ hs[i]·ps[i] in variable time with Pippenger's bucket
+// method: for every window of the signed digits of the scalars, the points
+// are first sorted into buckets by their digit, and the buckets are then
+// summed with their weights using only additions.
+func (c *curvePoint) pippenger(hs []halfScalar, ps []curvePoint) {
+	w := pippengerWindow(len(hs))
+	digits := make([][]int32, len(hs))
+	for i := range hs {
+		digits[i] = recodeSigned(hs[i], w)
+	}
+
+	buckets := make([]curvePoint, 1<<(w-1))
+	sum, run, win, t := &curvePoint{}, &curvePoint{}, &curvePoint{}, &curvePoint{}
+	sum.SetInfinity()
+	for i := len(digits[0]) - 1; i >= 0; i-- {
+		for j := uint(0); j < w; j++ {
+			t.Double(sum)
 			sum.Set(t)
 		}
+
+		for b := range buckets {
+			buckets[b].SetInfinity()
+		}
+		for k := range digits {
+			if d := digits[k][i]; d > 0 {
+				buckets[d-1].Add(&buckets[d-1], &ps[k])
+			} else if d < 0 {
+				t.Neg(&ps[k])
+				buckets[-d-1].Add(&buckets[-d-1], t)
+			}
+		}
+
+		// win = Σ (b+1)·buckets[b] = Σ_b Σ_{b' ≥ b} buckets[b']
+		run.SetInfinity()
+		win.SetInfinity()
+		for b := len(buckets) - 1; b >= 0; b-- {
+			run.Add(run, &buckets[b])
+			win.Add(win, run)
+		}
+		sum.Add(sum, win)
 	}
 
 	c.Set(sum)
 }
 
+// curveOddMultiples sets table to the odd multiples a, 3a, ..., of a.
+func curveOddMultiples(table *[mulTableSize]curvePoint, a *curvePoint) {
+	a2 := &curvePoint{}
+	a2.Double(a)
+	table[0].Set(a)
+	for i := 1; i < mulTableSize; i++ {
+		table[i].Add(&table[i-1], a2)
+	}
+}
+
+// phi sets c = φ(a) = (βx, y), which is glvLambda·a for a in G₁.
+func (c *curvePoint) phi(a *curvePoint) {
+	gfpMul(&c.x, &a.x, xiTo2PSquaredMinus2Over3)
+	c.y.Set(&a.y)
+	c.z.Set(&a.z)
+	c.t.Set(&a.t)
+}
+
+// lookup sets c to d·P, given the odd multiples of P in table and the odd
+// digit d, without a memory access pattern that depends on d.
+func (c *curvePoint) lookup(table *[mulTableSize]curvePoint, d int8) {
+	neg, idx := ctAbsIndex(d)
+
+	for i := range table {
+		c.condSet(&table[i], ctEq(i, idx))
+	}
+	c.condNeg(c, neg)
+}
+
+// condSet sets c to a if mask is all ones, and leaves it unchanged if mask is
+// zero.
+func (c *curvePoint) condSet(a *curvePoint, mask uint64) {
+	gfpCMov(&c.x, &a.x, mask)
+	gfpCMov(&c.y, &a.y, mask)
+	gfpCMov(&c.z, &a.z, mask)
+	gfpCMov(&c.t, &a.t, mask)
+}
+
+// condNeg sets c to -a if mask is all ones, and to a if mask is zero.
+func (c *curvePoint) condNeg(a *curvePoint, mask uint64) {
+	ny := &gfP{}
+	gfpNeg(ny, &a.y)
+	c.Set(a)
+	gfpCMov(&c.y, ny, mask)
+}
+
 func (c *curvePoint) MakeAffine() {
 	if c.z == *newGFp(1) {
 		return
@@ -215,7 +518,7 @@ func (c *curvePoint) MakeAffine() {
 
 	t, zInv2 := &gfP{}, &gfP{}
 	gfpMul(t, &c.y, zInv)
-	gfpMul(zInv2, zInv, zInv)
+	gfpSqr(zInv2, zInv)
 
 	gfpMul(&c.x, &c.x, zInv2)
 	gfpMul(&c.y, t, zInv2)
@@ -224,6 +527,68 @@ func (c *curvePoint) MakeAffine() {
 	c.t = *newGFp(1)
 }
 
+// curveBatchMakeAffine converts all points to affine form like MakeAffine,
+// but with Montgomery's trick: the z coordinates share a single inversion,
+// at the cost of three multiplications per point. The inverses of the z
+// coordinates are then multiplied into the coordinates with gfpMulVec.
+func curveBatchMakeAffine(ps []*curvePoint) {
+	n := 0
+	for _, c := range ps {
+		if !c.IsInfinity() && c.z != *newGFp(1) {
+			n++
+		}
+	}
+	// todo lists the points that need an inversion, from the last to the
+	// first, and xs, ys and zInv their coordinates and the inverses of their
+	// z coordinates.
+	todo := make([]*curvePoint, 0, n)
+	buf := make([]gfP, len(ps)+4*n)
+	xs, ys, zInv, zInv2 := buf[:n], buf[n:2*n], buf[2*n:3*n], buf[3*n:4*n]
+
+	// prods[i] is the product of the z coordinates of ps[:i+1] that need an
+	// inversion.
+	prods := buf[4*n:]
+	acc := *newGFp(1)
+	for i, c := range ps {
+		if !c.IsInfinity() && c.z != *newGFp(1) {
+			gfpMul(&acc, &acc, &c.z)
+		}
+		prods[i] = acc
+	}
+
+	inv := &gfP{}
+	inv.Invert(&acc)
+
+	for i := len(ps) - 1; i >= 0; i-- {
+		c := ps[i]
+		if c.IsInfinity() || c.z == *newGFp(1) {
+			c.MakeAffine()
+			continue
+		}
+
+		// zInv = prods[i-1]/prods[i], and inv becomes 1/prods[i-1].
+		j := len(todo)
+		if i > 0 {
+			gfpMul(&zInv[j], inv, &prods[i-1])
+		} else {
+			zInv[j].Set(inv)
+		}
+		gfpMul(inv, inv, &c.z)
+		xs[j], ys[j] = c.x, c.y
+		todo = append(todo, c)
+	}
+
+	gfpMulVec(zInv2, zInv, zInv)
+	gfpMulVec(ys, ys, zInv)
+	gfpMulVec(xs, xs, zInv2)
+	gfpMulVec(ys, ys, zInv2)
+	for j, c := range todo {
+		c.x, c.y = xs[j], ys[j]
+		c.z = *newGFp(1)
+		c.t = *newGFp(1)
+	}
+}
+
 func (c *curvePoint) Neg(a *curvePoint) {
 	c.x.Set(&a.x)
 	gfpNeg(&c.y, &a.y)
@@ -0,0 +1,10 @@
+// +build !go1.13
+
+package bn256
+
+import "testing"
+
+// reportCycles logs the cycles, since custom benchmark metrics need Go 1.13.
+func reportCycles(b *testing.B, cycles float64) {
+	b.Logf("%.0f cycles/op", cycles)
+}
@@ -0,0 +1,9 @@
+// +build go1.13
+
+package bn256
+
+import "testing"
+
+func reportCycles(b *testing.B, cycles float64) {
+	b.ReportMetric(cycles, "cycles/op")
+}
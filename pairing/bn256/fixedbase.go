@@ -0,0 +1,214 @@
+package bn256
+
+import (
+	"math/big"
+	"math/bits"
+	"sync"
+)
+
+// This file contains the multiplications of the generators of G₁ and G₂. For
+// every 4-bit window i of the scalar, the tables hold the affine odd multiples
+// (2j+1)·16ⁱ·G, so that a multiplication only takes one table lookup and one
+// mixed addition per window and no doublings at all.
+
+const (
+	// baseDigits is the number of digits of the regular recoding of a scalar
+	// below 2^256, and so the number of windows of the tables.
+	baseDigits = 256 / mulWindow
+)
+
+// curveAffine and twistAffine are points in affine form, whose z coordinate
+// is one.
+type curveAffine struct {
+	x, y gfP
+}
+
+type twistAffine struct {
+	x, y gfP2
+}
+
+var curveGenTable struct {
+	once  sync.Once
+	table *[baseDigits][mulTableSize]curveAffine
+}
+
+var twistGenTable struct {
+	once  sync.Once
+	table *[baseDigits][mulTableSize]twistAffine
+}
+
+// orderWords is Order as little-endian words.
+var orderWords = bigToWords(Order)
+
+// bigToWords returns the non-negative k < 2^256 as little-endian words. It
+// reads the words of k directly so that it does not allocate.
+func bigToWords(k *big.Int) (w [4]uint64) {
+	const wordBits = bits.UintSize
+	for i, b := range k.Bits() {
+		w[i*wordBits/64] |= uint64(b) << uint(i*wordBits%64)
+	}
+	return w
+}
+
+// orderWordsMod returns k mod Order as little-endian words.
+func orderWordsMod(k *big.Int) [4]uint64 {
+	if k.Sign() < 0 || k.Cmp(Order) >= 0 {
+		k = new(big.Int).Mod(k, Order)
+	}
+	return bigToWords(k)
+}
+
+// recodeBase returns the regular recoding of h < Order from recodeRegular,
+// with baseDigits digits. Since the recoding needs an odd scalar, an even h is
+// replaced by the odd Order-h, and neg is all ones to tell the caller to
+// negate the result.
+func recodeBase(h [4]uint64) (d [baseDigits]int8, neg uint64) {
+
+	// h = Order-h if h is even.
+	neg = -(^h[0] & 1)
+	var nh [4]uint64
+	var borrow uint64
+	for i := range h {
+		nh[i] = orderWords[i] - h[i] - borrow
+		borrow = ((^orderWords[i] & h[i]) | (^(orderWords[i] ^ h[i]) & nh[i])) >> 63
+	}
+	for i := range h {
+		h[i] ^= (h[i] ^ nh[i]) & neg
+	}
+
+	const mask = 1<<(mulWindow+1) - 1
+	for i := 0; i < baseDigits-1; i++ {
+		d[i] = int8(h[0]&mask) - 1<<mulWindow
+
+		// h = (h - dᵢ) / 2^mulWindow, which is odd again.
+		for j := 0; j < len(h)-1; j++ {
+			h[j] = h[j]>>mulWindow | h[j+1]<<(64-mulWindow)
+		}
+		h[len(h)-1] >>= mulWindow
+		h[0] |= 1
+	}
+	d[baseDigits-1] = int8(h[0])
+	return d, neg
+}
+
+func newCurveGenTable() *[baseDigits][mulTableSize]curveAffine {
+	table := &[baseDigits][mulTableSize]curveAffine{}
+
+	base, base2, t := &curvePoint{}, &curvePoint{}, &curvePoint{}
+	base.Set(curveGen)
+	for i := range table {
+		base2.Double(base)
+		t.Set(base)
+		for j := range table[i] {
+			if j > 0 {
+				t.Add(t, base2)
+			}
+			a := t.Clone()
+			a.MakeAffine()
+			table[i][j] = curveAffine{a.x, a.y}
+		}
+
+		// base = 16·base
+		for w := 0; w < mulWindow; w += 2 {
+			t.Double(base)
+			base.Double(t)
+		}
+	}
+	return table
+}
+
+func newTwistGenTable() *[baseDigits][mulTableSize]twistAffine {
+	table := &[baseDigits][mulTableSize]twistAffine{}
+
+	base, base2, t := &twistPoint{}, &twistPoint{}, &twistPoint{}
+	base.Set(twistGen)
+	for i := range table {
+		base2.Double(base)
+		t.Set(base)
+		for j := range table[i] {
+			if j > 0 {
+				t.Add(t, base2)
+			}
+			a := t.Clone()
+			a.MakeAffine()
+			table[i][j] = twistAffine{a.x, a.y}
+		}
+
+		for w := 0; w < mulWindow; w += 2 {
+			t.Double(base)
+			base.Double(t)
+		}
+	}
+	return table
+}
+
+// mulBase sets c = scalar·curveGen for the little-endian words of a scalar
+// below Order, with the precomputed tables of the generator and in constant
+// time like Mul.
+func (c *curvePoint) mulBase(scalar [4]uint64) {
+	curveGenTable.once.Do(func() {
+		curveGenTable.table = newCurveGenTable()
+	})
+	table := curveGenTable.table
+
+	digits, negAll := recodeBase(scalar)
+
+	sum, t := &curvePoint{}, &curveAffine{}
+	for i := range table {
+		neg, idx := ctAbsIndex(digits[i])
+		for j := range table[i] {
+			mask := ctEq(j, idx)
+			gfpCMov(&t.x, &table[i][j].x, mask)
+			gfpCMov(&t.y, &table[i][j].y, mask)
+		}
+		ny := &gfP{}
+		gfpNeg(ny, &t.y)
+		gfpCMov(&t.y, ny, neg^negAll)
+
+		if i == 0 {
+			sum.x, sum.y = t.x, t.y
+			sum.z, sum.t = *newGFp(1), *newGFp(1)
+		} else {
+			sum.addAffine(sum, t)
+		}
+	}
+
+	c.Set(sum)
+}
+
+// mulBase sets c = scalar·twistGen for the little-endian words of a scalar
+// below Order, with the precomputed tables of the generator and in constant
+// time like Mul.
+func (c *twistPoint) mulBase(scalar [4]uint64) {
+	twistGenTable.once.Do(func() {
+		twistGenTable.table = newTwistGenTable()
+	})
+	table := twistGenTable.table
+
+	digits, negAll := recodeBase(scalar)
+
+	sum, t := &twistPoint{}, &twistAffine{}
+	for i := range table {
+		neg, idx := ctAbsIndex(digits[i])
+		for j := range table[i] {
+			mask := ctEq(j, idx)
+			gfpCMov(&t.x.x, &table[i][j].x.x, mask)
+			gfpCMov(&t.x.y, &table[i][j].x.y, mask)
+			gfpCMov(&t.y.x, &table[i][j].y.x, mask)
+			gfpCMov(&t.y.y, &table[i][j].y.y, mask)
+		}
+		ny := (&gfP2{}).Neg(&t.y)
+		gfpCMov(&t.y.x, &ny.x, neg^negAll)
+		gfpCMov(&t.y.y, &ny.y, neg^negAll)
+
+		if i == 0 {
+			sum.x, sum.y = t.x, t.y
+			sum.z.SetOne()
+			sum.t.SetOne()
+		} else {
+			sum.addAffine(sum, t)
+		}
+	}
+
+	c.Set(sum)
+}
@@ -1,21 +1,37 @@
 package bn256
 
 import (
+	"encoding/binary"
 	"fmt"
+	"time"
+
+	"go.dedis.ch/kyber/v3/util/metrics"
 )
 
 type gfP [4]uint64
 
-func newGFp(x int64) (out *gfP) {
+// gfPWide is an unreduced 512-bit product of field elements, kept modulo
+// p·2²⁵⁶. Sums and differences of products are accumulated in it and then
+// Montgomery-reduced once with gfpReduceWide, instead of once per product.
+type gfPWide [8]uint64
+
+// newGFp returns x in Montgomery form. It is small enough to be inlined, so
+// that the result does not need to be allocated on the heap.
+func newGFp(x int64) *gfP {
+	out := &gfP{}
+	out.setInt64(x)
+	return out
+}
+
+func (e *gfP) setInt64(x int64) {
 	if x >= 0 {
-		out = &gfP{uint64(x)}
+		*e = gfP{uint64(x)}
 	} else {
-		out = &gfP{uint64(-x)}
-		gfpNeg(out, out)
+		*e = gfP{uint64(-x)}
+		gfpNeg(e, e)
 	}
 
-	montEncode(out, out)
-	return out
+	montEncode(e, e)
 }
 
 func (e *gfP) String() string {
@@ -29,40 +45,130 @@ func (e *gfP) Set(f *gfP) {
 	e[3] = f[3]
 }
 
-func (e *gfP) Invert(f *gfP) {
-	bits := [4]uint64{0x185cac6c5e089665, 0xee5b88d120b5b59e, 0xaa6fecb86184dc21, 0x8fb501e34aa387f9}
+// pMinus2 and pPlus1Over4 are the exponents p-2 of the inversion and (p+1)/4
+// of the square root, as little-endian words.
+var (
+	pMinus2     = [4]uint64{0x185cac6c5e089665, 0xee5b88d120b5b59e, 0xaa6fecb86184dc21, 0x8fb501e34aa387f9}
+	pPlus1Over4 = [4]uint64{0x86172b1b1782259a, 0x7b96e234482d6d67, 0x6a9bfb2e18613708, 0x23ed4078d2a8e1fe}
+)
+
+// expWindow is the maximal window size of exp.
+const expWindow = 5
 
-	sum, power := &gfP{}, &gfP{}
-	sum.Set(rN1)
-	power.Set(f)
+// exp sets e = f^power for a public power. It uses a sliding window
+// exponentiation with the odd powers f, f³, ..., f³¹, so that for p-2 it takes
+// 252 squarings and 59 multiplications instead of the 256 and 125 of the
+// binary method. The sequence of operations only depends on power, not on f.
+func (e *gfP) exp(f *gfP, power *[4]uint64) {
+	bit := func(i int) uint64 {
+		return power[i/64] >> uint(i%64) & 1
+	}
+
+	var table [1 << (expWindow - 1)]gfP
+	f2 := &gfP{}
+	gfpSqr(f2, f)
+	table[0].Set(f)
+	for i := 1; i < len(table); i++ {
+		gfpMul(&table[i], &table[i-1], f2)
+	}
 
-	for word := 0; word < 4; word++ {
-		for bit := uint(0); bit < 64; bit++ {
-			if (bits[word]>>bit)&1 == 1 {
-				gfpMul(sum, sum, power)
+	// sum is initialized by the first window.
+	sum := newGFp(1)
+	first := true
+	for i := 255; i >= 0; {
+		if bit(i) == 0 {
+			if !first {
+				gfpSqr(sum, sum)
 			}
-			gfpMul(power, power, power)
+			i--
+			continue
+		}
+
+		// The window [j, i] ends with a set bit.
+		j := i - expWindow + 1
+		if j < 0 {
+			j = 0
+		}
+		for bit(j) == 0 {
+			j++
+		}
+		v := 0
+		for k := i; k >= j; k-- {
+			v = v<<1 | int(bit(k))
+			if !first {
+				gfpSqr(sum, sum)
+			}
+		}
+
+		if first {
+			sum.Set(&table[v>>1])
+			first = false
+		} else {
+			gfpMul(sum, sum, &table[v>>1])
 		}
+		i = j - 1
 	}
 
-	gfpMul(sum, sum, r3)
 	e.Set(sum)
 }
 
-func (e *gfP) Marshal(out []byte) {
-	for w := uint(0); w < 4; w++ {
-		for b := uint(0); b < 8; b++ {
-			out[8*w+b] = byte(e[3-w] >> (56 - 8*b))
-		}
+// gfpMulVec sets c[i] = a[i]*b[i] for every i, where the slices have the same
+// length and c[i] may be a[i] or b[i]. On amd64 CPUs with AVX-512 IFMA, the
+// products are computed eight at a time; the rest are computed with gfpMul.
+func gfpMulVec(c, a, b []gfP) {
+	if len(a) != len(c) || len(b) != len(c) {
+		panic("bn256: gfpMulVec of slices of different lengths")
+	}
+	for i := gfpMulVecBlocks(c, a, b); i < len(c); i++ {
+		gfpMul(&c[i], &a[i], &b[i])
 	}
 }
 
-func (e *gfP) Unmarshal(in []byte) {
-	for w := uint(0); w < 4; w++ {
-		for b := uint(0); b < 8; b++ {
-			e[3-w] += uint64(in[8*w+b]) << (56 - 8*b)
-		}
+var invertCounter = metrics.NewCounter("bn256.gfP.Invert")
+
+// Invert sets e = f⁻¹ = f^(p-2).
+func (e *gfP) Invert(f *gfP) {
+	if metrics.Enabled {
+		defer invertCounter.Since(time.Now())
 	}
+	e.exp(f, &pMinus2)
+}
+
+// Sqrt sets e to the square root f^((p+1)/4) of f, using that p ≡ 3 mod 4,
+// and reports whether f is a square. If it isn't, e is a square root of -f
+// instead. It takes constant time.
+func (e *gfP) Sqrt(f *gfP) bool {
+	return e.sqrt(f) == 1
+}
+
+// sqrt is Sqrt, but returns 1 if f is a square and 0 otherwise.
+func (e *gfP) sqrt(f *gfP) uint64 {
+	y, y2 := &gfP{}, &gfP{}
+	y.exp(f, &pPlus1Over4)
+	gfpSqr(y2, y)
+	ok := gfpEqual(y2, f)
+	e.Set(y)
+	return ok
+}
+
+// Marshal writes the words of e to the first 32 bytes of out in big-endian
+// order, without decoding them from Montgomery form.
+func (e *gfP) Marshal(out []byte) {
+	_ = out[31] // bounds check hint to the compiler
+	binary.BigEndian.PutUint64(out[0:], e[3])
+	binary.BigEndian.PutUint64(out[8:], e[2])
+	binary.BigEndian.PutUint64(out[16:], e[1])
+	binary.BigEndian.PutUint64(out[24:], e[0])
+}
+
+// Unmarshal sets e to the big-endian words in the first 32 bytes of in,
+// without reducing them or encoding them in Montgomery form.
+func (e *gfP) Unmarshal(in []byte) {
+	_ = in[31] // bounds check hint to the compiler
+	e[3] = binary.BigEndian.Uint64(in[0:])
+	e[2] = binary.BigEndian.Uint64(in[8:])
+	e[1] = binary.BigEndian.Uint64(in[16:])
+	e[0] = binary.BigEndian.Uint64(in[24:])
 }
 
 func montEncode(c, a *gfP) { gfpMul(c, a, r2) }
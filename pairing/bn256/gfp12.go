@@ -154,15 +154,18 @@ func (e *gfP12) Sub(a, b *gfP12) *gfP12 {
 }
 
 func (e *gfP12) Mul(a, b *gfP12) *gfP12 {
-	tx := (&gfP6{}).Mul(&a.x, &b.y)
-	t := (&gfP6{}).Mul(&b.x, &a.y)
+	// The gfP6 products are summed unreduced, so that every coefficient of the
+	// result is only reduced once.
+	tx := (&gfP6Wide{}).Mul(&a.x, &b.y)
+	t := (&gfP6Wide{}).Mul(&b.x, &a.y)
 	tx.Add(tx, t)
 
-	ty := (&gfP6{}).Mul(&a.y, &b.y)
+	ty := (&gfP6Wide{}).Mul(&a.y, &b.y)
 	t.Mul(&a.x, &b.x).MulTau(t)
+	ty.Add(ty, t)
 
-	e.x.Set(tx)
-	e.y.Add(ty, t)
+	e.x.Reduce(tx)
+	e.y.Reduce(ty)
 	return e
 }
 
@@ -189,6 +192,77 @@ func (e *gfP12) Exp(a *gfP12, power *big.Int) *gfP12 {
 	return e
 }
 
+// CyclotomicExp sets e = a^power like Exp, but only for a in the cyclotomic
+// subgroup, which includes GT and the output of the easy part of the final
+// exponentiation. It uses the cheaper CyclotomicSquare.
+func (e *gfP12) CyclotomicExp(a *gfP12, power *big.Int) *gfP12 {
+	sum := (&gfP12{}).SetOne()
+	t := &gfP12{}
+
+	for i := power.BitLen() - 1; i >= 0; i-- {
+		t.CyclotomicSquare(sum)
+		if power.Bit(i) != 0 {
+			sum.Mul(t, a)
+		} else {
+			sum.Set(t)
+		}
+	}
+
+	e.Set(sum)
+	return e
+}
+
+// CyclotomicSquare sets e = a² for a in the cyclotomic subgroup and then
+// returns e. See "Faster Squaring in the Cyclotomic Subgroup of Sixth Degree
+// Extensions", Granger and Scott, https://eprint.iacr.org/2009/565.pdf
+func (e *gfP12) CyclotomicSquare(a *gfP12) *gfP12 {
+	// With ω³=s and s²=ξ, a = A + Bω + Cω² where A, B and C are in
+	// GF(p²)[s]. Its square is A' + B'ω + C'ω² with
+	//   A' = 3A² - 2Ā
+	//   B' = 3sC² + 2B̄
+	//   C' = 3B² - 2C̄
+	// where the bar is conjugation over GF(p²), s ↦ -s.
+	// In terms of the coefficients of a, A = a.y.z + a.x.y·s,
+	// B = a.x.z + a.y.x·s and C = a.y.y + a.x.x·s.
+	a0, a1 := &gfP2{}, &gfP2{}
+	fp4Square(a0, a1, &a.y.z, &a.x.y)
+	b0, b1 := &gfP2{}, &gfP2{}
+	fp4Square(b0, b1, &a.x.z, &a.y.x)
+	c0, c1 := &gfP2{}, &gfP2{}
+	fp4Square(c0, c1, &a.y.y, &a.x.x)
+	c1.MulXi(c1)
+
+	// Each output coefficient is 3x ∓ 2y = 2(x ∓ y) + x.
+	t := &gfP2{}
+	t.Sub(a0, &a.y.z).Add(t, t)
+	e.y.z.Add(t, a0)
+	t.Add(a1, &a.x.y).Add(t, t)
+	e.x.y.Add(t, a1)
+
+	t.Add(c1, &a.x.z).Add(t, t)
+	e.x.z.Add(t, c1)
+	t.Sub(c0, &a.y.x).Add(t, t)
+	e.y.x.Add(t, c0)
+
+	t.Sub(b0, &a.y.y).Add(t, t)
+	e.y.y.Add(t, b0)
+	t.Add(b1, &a.x.x).Add(t, t)
+	e.x.x.Add(t, b1)
+	return e
+}
+
+// fp4Square sets (c0, c1) to (a+bs)² = (a²+ξb²) + 2ab·s where s²=ξ.
+func fp4Square(c0, c1, a, b *gfP2) {
+	t0 := (&gfP2{}).Square(a)
+	t1 := (&gfP2{}).Square(b)
+
+	c1.Add(a, b)
+	c1.Square(c1).Sub(c1, t0).Sub(c1, t1)
+
+	c0.MulXi(t1)
+	c0.Add(c0, t0)
+}
+
 func (e *gfP12) Square(a *gfP12) *gfP12 {
 	// Complex squaring algorithm
 	v0 := (&gfP6{}).Mul(&a.x, &a.y)
@@ -76,18 +76,7 @@ func (e *gfP2) Sub(a, b *gfP2) *gfP2 {
 // See "Multiplication and Squaring in Pairing-Friendly Fields",
 // http://eprint.iacr.org/2006/471.pdf
 func (e *gfP2) Mul(a, b *gfP2) *gfP2 {
-	tx, t := &gfP{}, &gfP{}
-	gfpMul(tx, &a.x, &b.y)
-	gfpMul(t, &b.x, &a.y)
-	gfpAdd(tx, tx, t)
-
-	ty := &gfP{}
-	gfpMul(ty, &a.y, &b.y)
-	gfpMul(t, &a.x, &b.x)
-	gfpSub(ty, ty, t)
-
-	e.x.Set(tx)
-	e.y.Set(ty)
+	gfp2Mul(e, a, b)
 	return e
 }
 
@@ -118,16 +107,7 @@ func (e *gfP2) MulXi(a *gfP2) *gfP2 {
 func (e *gfP2) Square(a *gfP2) *gfP2 {
 	// Complex squaring algorithm:
 	// (xi+y)² = (x+y)(y-x) + 2*i*x*y
-	tx, ty := &gfP{}, &gfP{}
-	gfpSub(tx, &a.y, &a.x)
-	gfpAdd(ty, &a.x, &a.y)
-	gfpMul(ty, tx, ty)
-
-	gfpMul(tx, &a.x, &a.y)
-	gfpAdd(tx, tx, tx)
-
-	e.x.Set(tx)
-	e.y.Set(ty)
+	gfp2Sqr(e, a)
 	return e
 }
 
@@ -135,8 +115,8 @@ func (e *gfP2) Invert(a *gfP2) *gfP2 {
 	// See "Implementing cryptographic pairings", M. Scott, section 3.2.
 	// ftp://136.206.11.249/pub/crypto/pairings.pdf
 	t1, t2 := &gfP{}, &gfP{}
-	gfpMul(t1, &a.x, &a.x)
-	gfpMul(t2, &a.y, &a.y)
+	gfpSqr(t1, &a.x)
+	gfpSqr(t2, &a.y)
 	gfpAdd(t1, t1, t2)
 
 	inv := &gfP{}
@@ -149,6 +129,60 @@ func (e *gfP2) Invert(a *gfP2) *gfP2 {
 	return e
 }
 
+// Sqrt sets e to a square root of a and returns true if a is a square, and
+// returns false otherwise. It uses the complex method: if n² = x²+y² is the
+// norm of a = xi+y, then a root is x/(2r)·i+r with r² = (y±n)/2. It runs in
+// variable time.
+func (e *gfP2) Sqrt(a *gfP2) bool {
+	if a.x == (gfP{0}) {
+		// a is in GF(p), so a or -a is a square there, and -a = (ai)².
+		r := &gfP{}
+		if r.Sqrt(&a.y) {
+			e.x, e.y = gfP{0}, *r
+			return true
+		}
+		gfpNeg(r, &a.y)
+		r.Sqrt(r)
+		e.x, e.y = *r, gfP{0}
+		return true
+	}
+
+	n, t := &gfP{}, &gfP{}
+	gfpSqr(n, &a.x)
+	gfpSqr(t, &a.y)
+	gfpAdd(n, n, t)
+	if !n.Sqrt(n) {
+		return false
+	}
+
+	// d = (y+n)/2, or else (y-n)/2. Since x ≠ 0, neither is zero and one of
+	// them is a square.
+	half := &gfP{}
+	half.Invert(newGFp(2))
+	d, r := &gfP{}, &gfP{}
+	gfpAdd(d, &a.y, n)
+	gfpMul(d, d, half)
+	if !r.Sqrt(d) {
+		gfpSub(d, &a.y, n)
+		gfpMul(d, d, half)
+		r.Sqrt(d)
+	}
+
+	// x/(2r)
+	gfpAdd(t, r, r)
+	t.Invert(t)
+	gfpMul(&e.x, &a.x, t)
+	e.y = *r
+	return true
+}
+
+// Reduce sets e to the Montgomery reduction of a and then returns e.
+func (e *gfP2) Reduce(a *gfP2Wide) *gfP2 {
+	gfpReduceWide(&e.x, &a.x)
+	gfpReduceWide(&e.y, &a.y)
+	return e
+}
+
 // Clone makes a hard copy of the field
 func (e *gfP2) Clone() gfP2 {
 	n := gfP2{}
@@ -157,3 +191,44 @@ func (e *gfP2) Clone() gfP2 {
 
 	return n
 }
+
+// gfP2Wide is an unreduced element of gfP2, see gfPWide.
+type gfP2Wide struct {
+	x, y gfPWide // value is xi+y.
+}
+
+func (e *gfP2Wide) Add(a, b *gfP2Wide) *gfP2Wide {
+	gfpAddWide(&e.x, &a.x, &b.x)
+	gfpAddWide(&e.y, &a.y, &b.y)
+	return e
+}
+
+func (e *gfP2Wide) Sub(a, b *gfP2Wide) *gfP2Wide {
+	gfpSubWide(&e.x, &a.x, &b.x)
+	gfpSubWide(&e.y, &a.y, &b.y)
+	return e
+}
+
+// Mul sets e to the unreduced product of a and b and then returns e.
+func (e *gfP2Wide) Mul(a, b *gfP2) *gfP2Wide {
+	gfp2MulNoReduce(e, a, b)
+	return e
+}
+
+// MulXi sets e=ξa where ξ=i+3 and then returns e.
+func (e *gfP2Wide) MulXi(a *gfP2Wide) *gfP2Wide {
+	// (xi+y)(i+3) = (3x+y)i+(3y-x)
+	tx := &gfPWide{}
+	gfpAddWide(tx, &a.x, &a.x)
+	gfpAddWide(tx, tx, &a.x)
+	gfpAddWide(tx, tx, &a.y)
+
+	ty := &gfPWide{}
+	gfpAddWide(ty, &a.y, &a.y)
+	gfpAddWide(ty, ty, &a.y)
+	gfpSubWide(ty, ty, &a.x)
+
+	e.x = *tx
+	e.y = *ty
+	return e
+}
@@ -92,33 +92,8 @@ func (e *gfP6) Sub(a, b *gfP6) *gfP6 {
 }
 
 func (e *gfP6) Mul(a, b *gfP6) *gfP6 {
-	// "Multiplication and Squaring on Pairing-Friendly Fields"
-	// Section 4, Karatsuba method.
-	// http://eprint.iacr.org/2006/471.pdf
-	v0 := (&gfP2{}).Mul(&a.z, &b.z)
-	v1 := (&gfP2{}).Mul(&a.y, &b.y)
-	v2 := (&gfP2{}).Mul(&a.x, &b.x)
-
-	t0 := (&gfP2{}).Add(&a.x, &a.y)
-	t1 := (&gfP2{}).Add(&b.x, &b.y)
-	tz := (&gfP2{}).Mul(t0, t1)
-	tz.Sub(tz, v1).Sub(tz, v2).MulXi(tz).Add(tz, v0)
-
-	t0.Add(&a.y, &a.z)
-	t1.Add(&b.y, &b.z)
-	ty := (&gfP2{}).Mul(t0, t1)
-	t0.MulXi(v2)
-	ty.Sub(ty, v0).Sub(ty, v1).Add(ty, t0)
-
-	t0.Add(&a.x, &a.z)
-	t1.Add(&b.x, &b.z)
-	tx := (&gfP2{}).Mul(t0, t1)
-	tx.Sub(tx, v0).Add(tx, v1).Sub(tx, v2)
-
-	e.x.Set(tx)
-	e.y.Set(ty)
-	e.z.Set(tz)
-	return e
+	t := (&gfP6Wide{}).Mul(a, b)
+	return e.Reduce(t)
 }
 
 func (e *gfP6) MulScalar(a *gfP6, b *gfP2) *gfP6 {
@@ -212,6 +187,14 @@ func (e *gfP6) Invert(a *gfP6) *gfP6 {
 	return e
 }
 
+// Reduce sets e to the Montgomery reduction of a and then returns e.
+func (e *gfP6) Reduce(a *gfP6Wide) *gfP6 {
+	e.x.Reduce(&a.x)
+	e.y.Reduce(&a.y)
+	e.z.Reduce(&a.z)
+	return e
+}
+
 // Clone makes a hard copy of the field
 func (e *gfP6) Clone() gfP6 {
 	n := gfP6{
@@ -222,3 +205,72 @@ func (e *gfP6) Clone() gfP6 {
 
 	return n
 }
+
+// gfP6Wide is an unreduced element of gfP6, see gfPWide.
+type gfP6Wide struct {
+	x, y, z gfP2Wide // value is xτ² + yτ + z
+}
+
+func (e *gfP6Wide) Add(a, b *gfP6Wide) *gfP6Wide {
+	e.x.Add(&a.x, &b.x)
+	e.y.Add(&a.y, &b.y)
+	e.z.Add(&a.z, &b.z)
+	return e
+}
+
+func (e *gfP6Wide) Sub(a, b *gfP6Wide) *gfP6Wide {
+	e.x.Sub(&a.x, &b.x)
+	e.y.Sub(&a.y, &b.y)
+	e.z.Sub(&a.z, &b.z)
+	return e
+}
+
+// Mul sets e to the unreduced product of a and b and then returns e. Only one
+// reduction per coefficient is needed by the caller, instead of one per gfP2
+// product.
+func (e *gfP6Wide) Mul(a, b *gfP6) *gfP6Wide {
+	// "Multiplication and Squaring on Pairing-Friendly Fields"
+	// Section 4, Karatsuba method.
+	// http://eprint.iacr.org/2006/471.pdf
+	v0 := (&gfP2Wide{}).Mul(&a.z, &b.z)
+	v1 := (&gfP2Wide{}).Mul(&a.y, &b.y)
+	v2 := (&gfP2Wide{}).Mul(&a.x, &b.x)
+
+	t0 := (&gfP2{}).Add(&a.x, &a.y)
+	t1 := (&gfP2{}).Add(&b.x, &b.y)
+	tz := (&gfP2Wide{}).Mul(t0, t1)
+	tz.Sub(tz, v1).Sub(tz, v2).MulXi(tz).Add(tz, v0)
+
+	t0.Add(&a.y, &a.z)
+	t1.Add(&b.y, &b.z)
+	ty := (&gfP2Wide{}).Mul(t0, t1)
+	t := (&gfP2Wide{}).MulXi(v2)
+	ty.Sub(ty, v0).Sub(ty, v1).Add(ty, t)
+
+	t0.Add(&a.x, &a.z)
+	t1.Add(&b.x, &b.z)
+	e.x.Mul(t0, t1)
+	e.x.Sub(&e.x, v0).Add(&e.x, v1).Sub(&e.x, v2)
+
+	e.y = *ty
+	e.z = *tz
+	return e
+}
+
+func (e *gfP6Wide) MulScalar(a *gfP6, b *gfP2) *gfP6Wide {
+	e.x.Mul(&a.x, b)
+	e.y.Mul(&a.y, b)
+	e.z.Mul(&a.z, b)
+	return e
+}
+
+// MulTau computes τ·(aτ²+bτ+c) = bτ²+cτ+aξ
+func (e *gfP6Wide) MulTau(a *gfP6Wide) *gfP6Wide {
+	tz := (&gfP2Wide{}).MulXi(&a.x)
+	ty := a.y
+
+	e.y = a.z
+	e.x = ty
+	e.z = *tz
+	return e
+}
@@ -33,8 +33,47 @@
 	CMOVQCC b2, a2 \
 	CMOVQCC b3, a3
 
+#define gfpAddBlock(ra, rb) \
+	\ // R8:R9:R10:R11 = a+b mod p
+	loadBlock(ra, R8,R9,R10,R11) \
+	MOVQ $0, R12 \
+	\
+	ADDQ  0+rb, R8 \
+	ADCQ  8+rb, R9 \
+	ADCQ 16+rb, R10 \
+	ADCQ 24+rb, R11 \
+	ADCQ $0, R12 \
+	\
+	gfpCarry(R8,R9,R10,R11,R12, R13,R14,R15,AX,BX)
+
+#define gfpSubBlock(ra, rb) \
+	\ // R8:R9:R10:R11 = a-b mod p
+	loadBlock(ra, R8,R9,R10,R11) \
+	\
+	MOVQ ·p2+0(SB), R12 \
+	MOVQ ·p2+8(SB), R13 \
+	MOVQ ·p2+16(SB), R14 \
+	MOVQ ·p2+24(SB), R15 \
+	MOVQ $0, AX \
+	\
+	SUBQ  0+rb, R8 \
+	SBBQ  8+rb, R9 \
+	SBBQ 16+rb, R10 \
+	SBBQ 24+rb, R11 \
+	\
+	CMOVQCC AX, R12 \
+	CMOVQCC AX, R13 \
+	CMOVQCC AX, R14 \
+	CMOVQCC AX, R15 \
+	\
+	ADDQ R12, R8 \
+	ADCQ R13, R9 \
+	ADCQ R14, R10 \
+	ADCQ R15, R11
+
 #include "mul_amd64.h"
 #include "mul_bmi2_amd64.h"
+#include "mul_adx_amd64.h"
 
 TEXT ·gfpNeg(SB),0,$0-16
 	MOVQ ·p2+0(SB), R8
@@ -109,7 +148,10 @@ TEXT ·gfpMul(SB),0,$160-24
 	MOVQ a+8(FP), DI
 	MOVQ b+16(FP), SI
 
-	// Jump to a slightly different implementation if MULX isn't supported.
+	// Use the interleaved MULX/ADCX/ADOX implementation if possible, or
+	// jump to a slightly different implementation if MULX isn't supported.
+	CMPB ·hasADX(SB), $0
+	JNE  adxMul
 	CMPB ·hasBMI2(SB), $0
 	JE   nobmi2Mul
 
@@ -122,8 +164,300 @@ TEXT ·gfpMul(SB),0,$160-24
 nobmi2Mul:
 	mul(0(DI),8(DI),16(DI),24(DI), 0(SI), 0(SP))
 	gfpReduce(0(SP))
+	JMP end
+
+adxMul:
+	mulADX(0(DI), 0(SI))
+	MOVQ R8, R14
+	MOVQ R9, R15
 
 end:
 	MOVQ c+0(FP), DI
 	storeBlock(R12,R13,R14,R15, 0(DI))
 	RET
+
+TEXT ·gfpSqr(SB),0,$160-16
+	MOVQ a+8(FP), DI
+
+	// The interleaved ADX multiplication beats a separate squaring and
+	// reduction, so use it when available.
+	CMPB ·hasADX(SB), $0
+	JNE  adxSqr
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2Sqr
+
+	sqrBMI2(0(DI),8(DI),16(DI),24(DI))
+	storeBlock( R8, R9,R10,R11,  0(SP))
+	storeBlock(R12,R13,R14,R15, 32(SP))
+	gfpReduceBMI2()
+	JMP end
+
+nobmi2Sqr:
+	sqr(0(DI),8(DI),16(DI),24(DI), 0(SP))
+	gfpReduce(0(SP))
+	JMP end
+
+adxSqr:
+	mulADX(0(DI), 0(DI))
+	MOVQ R8, R14
+	MOVQ R9, R15
+
+end:
+	MOVQ c+0(FP), DI
+	storeBlock(R12,R13,R14,R15, 0(DI))
+	RET
+
+// The gfpMul*Block macros compute the Montgomery product of the field elements
+// at ra and rb into R12:R13:R14:R15, using 0(SP) to 159(SP) as scratch space.
+#define gfpMulBlock(ra, rb) \
+	mul(0+ra,8+ra,16+ra,24+ra, rb, 0(SP)) \
+	gfpReduce(0(SP))
+
+#define gfpMulBMI2Block(ra, rb) \
+	mulBMI2(0+ra,8+ra,16+ra,24+ra, rb) \
+	storeBlock( R8, R9,R10,R11,  0(SP)) \
+	storeBlock(R12,R13,R14,R15, 32(SP)) \
+	gfpReduceBMI2()
+
+#define gfpMulADXBlock(ra, rb) \
+	mulADX(ra, rb) \
+	MOVQ R8, R14 \
+	MOVQ R9, R15
+
+TEXT ·gfp2Mul(SB),0,$288-24
+	MOVQ a+8(FP), DI
+	MOVQ b+16(FP), SI
+
+	// Karatsuba multiplication: with v0 = a.y*b.y and v1 = a.x*b.x,
+	// c.x = (a.x+a.y)(b.x+b.y) - v0 - v1 and c.y = v0 - v1.
+	gfpAddBlock(0(DI), 32(DI))
+	storeBlock(R8,R9,R10,R11, 160(SP))
+	gfpAddBlock(0(SI), 32(SI))
+	storeBlock(R8,R9,R10,R11, 192(SP))
+
+	CMPB ·hasADX(SB), $0
+	JNE  adxMul
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2Mul
+
+	gfpMulBMI2Block(32(DI), 32(SI))
+	storeBlock(R12,R13,R14,R15, 224(SP))
+	gfpMulBMI2Block(0(DI), 0(SI))
+	storeBlock(R12,R13,R14,R15, 256(SP))
+	gfpMulBMI2Block(160(SP), 192(SP))
+	JMP end
+
+nobmi2Mul:
+	gfpMulBlock(32(DI), 32(SI))
+	storeBlock(R12,R13,R14,R15, 224(SP))
+	gfpMulBlock(0(DI), 0(SI))
+	storeBlock(R12,R13,R14,R15, 256(SP))
+	gfpMulBlock(160(SP), 192(SP))
+	JMP end
+
+adxMul:
+	gfpMulADXBlock(32(DI), 32(SI))
+	storeBlock(R12,R13,R14,R15, 224(SP))
+	gfpMulADXBlock(0(DI), 0(SI))
+	storeBlock(R12,R13,R14,R15, 256(SP))
+	gfpMulADXBlock(160(SP), 192(SP))
+
+end:
+	storeBlock(R12,R13,R14,R15, 160(SP))
+	MOVQ c+0(FP), DI
+
+	gfpSubBlock(160(SP), 224(SP))
+	storeBlock(R8,R9,R10,R11, 160(SP))
+	gfpSubBlock(160(SP), 256(SP))
+	storeBlock(R8,R9,R10,R11, 0(DI))
+	gfpSubBlock(224(SP), 256(SP))
+	storeBlock(R8,R9,R10,R11, 32(DI))
+	RET
+
+TEXT ·gfp2Sqr(SB),0,$256-16
+	MOVQ a+8(FP), DI
+
+	// Complex squaring: (xi+y)² = (y-x)(y+x) + 2*i*x*y
+	gfpSubBlock(32(DI), 0(DI))
+	storeBlock(R8,R9,R10,R11, 160(SP))
+	gfpAddBlock(0(DI), 32(DI))
+	storeBlock(R8,R9,R10,R11, 192(SP))
+
+	CMPB ·hasADX(SB), $0
+	JNE  adxSqr
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2Sqr
+
+	gfpMulBMI2Block(0(DI), 32(DI))
+	storeBlock(R12,R13,R14,R15, 224(SP))
+	gfpMulBMI2Block(160(SP), 192(SP))
+	JMP end
+
+nobmi2Sqr:
+	gfpMulBlock(0(DI), 32(DI))
+	storeBlock(R12,R13,R14,R15, 224(SP))
+	gfpMulBlock(160(SP), 192(SP))
+	JMP end
+
+adxSqr:
+	gfpMulADXBlock(0(DI), 32(DI))
+	storeBlock(R12,R13,R14,R15, 224(SP))
+	gfpMulADXBlock(160(SP), 192(SP))
+
+end:
+	MOVQ c+0(FP), DI
+	storeBlock(R12,R13,R14,R15, 32(DI))
+	gfpAddBlock(224(SP), 224(SP))
+	storeBlock(R8,R9,R10,R11, 0(DI))
+	RET
+
+// The wide functions below operate on unreduced 512-bit products, which are
+// kept in the range [0, p·2²⁵⁶) so that sums and differences of them can be
+// Montgomery-reduced once with gfpReduceWide.
+
+#define gfpSubWideRegs(rb) \
+	\ // R8:...:R15 = R8:...:R15 - b mod p·2²⁵⁶, clobbers AX, BX, CX, DX, SI
+	SUBQ  0+rb, R8 \
+	SBBQ  8+rb, R9 \
+	SBBQ 16+rb, R10 \
+	SBBQ 24+rb, R11 \
+	SBBQ 32+rb, R12 \
+	SBBQ 40+rb, R13 \
+	SBBQ 48+rb, R14 \
+	SBBQ 56+rb, R15 \
+	\
+	MOVQ ·p2+0(SB), AX \
+	MOVQ ·p2+8(SB), BX \
+	MOVQ ·p2+16(SB), CX \
+	MOVQ ·p2+24(SB), DX \
+	MOVQ $0, SI \
+	\
+	CMOVQCC SI, AX \
+	CMOVQCC SI, BX \
+	CMOVQCC SI, CX \
+	CMOVQCC SI, DX \
+	\
+	ADDQ AX, R12 \
+	ADCQ BX, R13 \
+	ADCQ CX, R14 \
+	ADCQ DX, R15
+
+TEXT ·gfpMulNoReduce(SB),0,$0-24
+	MOVQ a+8(FP), DI
+	MOVQ b+16(FP), SI
+	MOVQ c+0(FP), BX
+
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2
+
+	mulBMI2(0(DI),8(DI),16(DI),24(DI), 0(SI))
+	MOVQ c+0(FP), DI
+	storeBlock( R8, R9,R10,R11,  0(DI))
+	storeBlock(R12,R13,R14,R15, 32(DI))
+	RET
+
+nobmi2:
+	mul(0(DI),8(DI),16(DI),24(DI), 0(SI), 0(BX))
+	RET
+
+TEXT ·gfpAddWide(SB),0,$0-24
+	MOVQ a+8(FP), DI
+	MOVQ b+16(FP), SI
+	loadBlock( 0(DI),  R8, R9,R10,R11)
+	loadBlock(32(DI), R12,R13,R14,R15)
+	MOVQ $0, AX
+
+	ADDQ  0(SI), R8
+	ADCQ  8(SI), R9
+	ADCQ 16(SI), R10
+	ADCQ 24(SI), R11
+	ADCQ 32(SI), R12
+	ADCQ 40(SI), R13
+	ADCQ 48(SI), R14
+	ADCQ 56(SI), R15
+	ADCQ $0, AX
+
+	MOVQ c+0(FP), DI
+	storeBlock(R8,R9,R10,R11, 0(DI))
+	gfpCarry(R12,R13,R14,R15,AX, R8,R9,R10,R11,BX)
+	storeBlock(R12,R13,R14,R15, 32(DI))
+	RET
+
+TEXT ·gfpSubWide(SB),0,$0-24
+	MOVQ a+8(FP), DI
+	MOVQ b+16(FP), SI
+	loadBlock( 0(DI),  R8, R9,R10,R11)
+	loadBlock(32(DI), R12,R13,R14,R15)
+
+	gfpSubWideRegs(0(SI))
+
+	MOVQ c+0(FP), DI
+	storeBlock( R8, R9,R10,R11,  0(DI))
+	storeBlock(R12,R13,R14,R15, 32(DI))
+	RET
+
+TEXT ·gfpReduceWide(SB),0,$160-16
+	MOVQ a+8(FP), DI
+	loadBlock( 0(DI),  R8, R9,R10,R11)
+	loadBlock(32(DI), R12,R13,R14,R15)
+	storeBlock( R8, R9,R10,R11,  0(SP))
+	storeBlock(R12,R13,R14,R15, 32(SP))
+
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2
+
+	gfpReduceBMI2()
+	JMP end
+
+nobmi2:
+	gfpReduce(0(SP))
+
+end:
+	MOVQ c+0(FP), DI
+	storeBlock(R12,R13,R14,R15, 0(DI))
+	RET
+
+TEXT ·gfp2MulNoReduce(SB),0,$256-24
+	MOVQ a+8(FP), DI
+	MOVQ b+16(FP), SI
+
+	// Karatsuba multiplication as in gfp2Mul, but the products and their
+	// differences are left unreduced.
+	gfpAddBlock(0(DI), 32(DI))
+	storeBlock(R8,R9,R10,R11, 128(SP))
+	gfpAddBlock(0(SI), 32(SI))
+	storeBlock(R8,R9,R10,R11, 160(SP))
+
+	CMPB ·hasBMI2(SB), $0
+	JE   nobmi2
+
+	mulBMI2(32(DI),40(DI),48(DI),56(DI), 32(SI))
+	storeBlock( R8, R9,R10,R11,  0(SP))
+	storeBlock(R12,R13,R14,R15, 32(SP))
+	mulBMI2(0(DI),8(DI),16(DI),24(DI), 0(SI))
+	storeBlock( R8, R9,R10,R11, 64(SP))
+	storeBlock(R12,R13,R14,R15, 96(SP))
+	mulBMI2(128(SP),136(SP),144(SP),152(SP), 160(SP))
+	JMP end
+
+nobmi2:
+	mul(32(DI),40(DI),48(DI),56(DI), 32(SI), 0(SP))
+	mul(0(DI),8(DI),16(DI),24(DI), 0(SI), 64(SP))
+	mul(128(SP),136(SP),144(SP),152(SP), 160(SP), 192(SP))
+	loadBlock(192(SP),  R8, R9,R10,R11)
+	loadBlock(224(SP), R12,R13,R14,R15)
+
+end:
+	gfpSubWideRegs(0(SP))
+	gfpSubWideRegs(64(SP))
+	MOVQ c+0(FP), DI
+	storeBlock( R8, R9,R10,R11,  0(DI))
+	storeBlock(R12,R13,R14,R15, 32(DI))
+
+	loadBlock( 0(SP),  R8, R9,R10,R11)
+	loadBlock(32(SP), R12,R13,R14,R15)
+	gfpSubWideRegs(64(SP))
+	MOVQ c+0(FP), DI
+	storeBlock( R8, R9,R10,R11, 64(DI))
+	storeBlock(R12,R13,R14,R15, 96(DI))
+	RET
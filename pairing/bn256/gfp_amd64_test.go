@@ -0,0 +1,60 @@
+// +build !generic
+
+package bn256
+
+import "testing"
+
+// TestGFpMulPaths checks all runtime-selected amd64 multiplication paths
+// against each other, whatever the CPU running the test supports.
+func TestGFpMulPaths(t *testing.T) {
+	oldBMI2, oldADX := hasBMI2, hasADX
+	defer func() { hasBMI2, hasADX = oldBMI2, oldADX }()
+
+	type path struct {
+		name      string
+		bmi2, adx bool
+	}
+	paths := []path{{"mul", false, false}}
+	if oldBMI2 {
+		paths = append(paths, path{"bmi2", true, false})
+	}
+	if oldADX {
+		paths = append(paths, path{"adx", true, true})
+	}
+
+	for i := 0; i < 1000; i++ {
+		a, b := randomGFp(), randomGFp()
+		a2, b2 := randomGFp2(), randomGFp2()
+		exp := gfpToBig(a)
+		exp.Mul(exp, gfpToBig(b)).Mod(exp, p)
+		sqr := gfpToBig(a)
+		sqr.Mul(sqr, sqr).Mod(sqr, p)
+
+		for _, pa := range paths {
+			hasBMI2, hasADX = pa.bmi2, pa.adx
+			c := &gfP{}
+			gfpMul(c, a, b)
+			if gfpToBig(c).Cmp(exp) != 0 {
+				t.Fatalf("%s: gfpMul(%s, %s) = %s", pa.name, a, b, c)
+			}
+			gfpSqr(c, a)
+			if gfpToBig(c).Cmp(sqr) != 0 {
+				t.Fatalf("%s: gfpSqr(%s) = %s", pa.name, a, c)
+			}
+
+			w := &gfPWide{}
+			gfpMulNoReduce(w, a, b)
+			gfpReduceWide(c, w)
+			if gfpToBig(c).Cmp(exp) != 0 {
+				t.Fatalf("%s: gfpReduceWide(gfpMulNoReduce(%s, %s)) = %s", pa.name, a, b, c)
+			}
+
+			want, got := &gfP2{}, &gfP2{}
+			gfp2Mul(want, a2, b2)
+			got.Reduce((&gfP2Wide{}).Mul(a2, b2))
+			if *got != *want {
+				t.Fatalf("%s: gfp2MulNoReduce(%s, %s) = %s, want %s", pa.name, a2, b2, got, want)
+			}
+		}
+	}
+}
@@ -18,6 +18,67 @@
 	MOVD ·p2+16(SB), p2 \
 	MOVD ·p2+24(SB), p3
 
+#define gfpAddRegs(a0,a1,a2,a3, b0,b1,b2,b3) \
+	\ // a = a+b mod p, clobbers b and R0
+	MOVD ZR, R0 \
+	ADDS b0, a0 \
+	ADCS b1, a1 \
+	ADCS b2, a2 \
+	ADCS b3, a3 \
+	ADCS ZR, R0 \
+	\
+	loadModulus(b0,b1,b2,b3) \
+	SUBS b0, a0, b0 \
+	SBCS b1, a1, b1 \
+	SBCS b2, a2, b2 \
+	SBCS b3, a3, b3 \
+	SBCS ZR, R0, R0 \
+	\
+	CSEL CS, b0, a0, a0 \
+	CSEL CS, b1, a1, a1 \
+	CSEL CS, b2, a2, a2 \
+	CSEL CS, b3, a3, a3
+
+#define gfpSubRegs(a0,a1,a2,a3, b0,b1,b2,b3) \
+	\ // a = a-b mod p, clobbers b
+	SUBS b0, a0 \
+	SBCS b1, a1 \
+	SBCS b2, a2 \
+	SBCS b3, a3 \
+	\
+	loadModulus(b0,b1,b2,b3) \
+	CSEL CS, ZR, b0, b0 \
+	CSEL CS, ZR, b1, b1 \
+	CSEL CS, ZR, b2, b2 \
+	CSEL CS, ZR, b3, b3 \
+	\
+	ADDS b0, a0 \
+	ADCS b1, a1 \
+	ADCS b2, a2 \
+	ADCS b3, a3
+
+#define gfpSubWideRegs(a0,a1,a2,a3,a4,a5,a6,a7, b0,b1,b2,b3,b4,b5,b6,b7) \
+	\ // a = a-b mod p·2²⁵⁶, clobbers b
+	SUBS b0, a0 \
+	SBCS b1, a1 \
+	SBCS b2, a2 \
+	SBCS b3, a3 \
+	SBCS b4, a4 \
+	SBCS b5, a5 \
+	SBCS b6, a6 \
+	SBCS b7, a7 \
+	\
+	loadModulus(b0,b1,b2,b3) \
+	CSEL CS, ZR, b0, b0 \
+	CSEL CS, ZR, b1, b1 \
+	CSEL CS, ZR, b2, b2 \
+	CSEL CS, ZR, b3, b3 \
+	\
+	ADDS b0, a4 \
+	ADCS b1, a5 \
+	ADCS b2, a6 \
+	ADCS b3, a7
+
 #include "mul_arm64.h"
 
 TEXT ·gfpNeg(SB),0,$0-16
@@ -111,3 +172,229 @@ TEXT ·gfpMul(SB),0,$0-24
 	MOVD c+0(FP), R0
 	storeBlock(R1,R2,R3,R4, 0(R0))
 	RET
+
+TEXT ·gfpSqr(SB),0,$0-16
+	MOVD a+8(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+
+	sqr(R9,R10,R11,R12,R13,R14,R15,R16)
+	gfpReduce()
+
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4, 0(R0))
+	RET
+
+TEXT ·gfp2Mul(SB),0,$144-24
+	// Karatsuba multiplication: with v0 = a.y*b.y and v1 = a.x*b.x,
+	// c.x = (a.x+a.y)(b.x+b.y) - v0 - v1 and c.y = v0 - v1.
+	MOVD a+8(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	gfpAddRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	storeBlock(R1,R2,R3,R4, 8(RSP))
+
+	MOVD b+16(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	gfpAddRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	storeBlock(R1,R2,R3,R4, 40(RSP))
+
+	MOVD a+8(FP), R0
+	loadBlock(32(R0), R1,R2,R3,R4)
+	MOVD b+16(FP), R0
+	loadBlock(32(R0), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+	gfpReduce()
+	storeBlock(R1,R2,R3,R4, 72(RSP))
+
+	MOVD a+8(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	MOVD b+16(FP), R0
+	loadBlock(0(R0), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+	gfpReduce()
+	storeBlock(R1,R2,R3,R4, 104(RSP))
+
+	loadBlock(8(RSP), R1,R2,R3,R4)
+	loadBlock(40(RSP), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+	gfpReduce()
+
+	loadBlock(72(RSP), R5,R6,R7,R8)
+	gfpSubRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	loadBlock(104(RSP), R5,R6,R7,R8)
+	gfpSubRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4, 0(R0))
+
+	loadBlock(72(RSP), R1,R2,R3,R4)
+	loadBlock(104(RSP), R5,R6,R7,R8)
+	gfpSubRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4, 32(R0))
+	RET
+
+TEXT ·gfp2Sqr(SB),0,$80-16
+	// Complex squaring: (xi+y)² = (y-x)(y+x) + 2*i*x*y
+	MOVD a+8(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+	gfpReduce()
+	storeBlock(R1,R2,R3,R4, 8(RSP))
+
+	MOVD a+8(FP), R0
+	loadBlock(32(R0), R1,R2,R3,R4)
+	loadBlock(0(R0), R5,R6,R7,R8)
+	gfpSubRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	storeBlock(R1,R2,R3,R4, 40(RSP))
+
+	loadBlock(0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	gfpAddRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	loadBlock(40(RSP), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+	gfpReduce()
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4, 32(R0))
+
+	loadBlock(8(RSP), R1,R2,R3,R4)
+	loadBlock(8(RSP), R5,R6,R7,R8)
+	gfpAddRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4, 0(R0))
+	RET
+
+// The wide functions below operate on unreduced 512-bit products, which are
+// kept in the range [0, p·2²⁵⁶) so that sums and differences of them can be
+// Montgomery-reduced once with gfpReduceWide.
+
+TEXT ·gfpMulNoReduce(SB),0,$0-24
+	MOVD a+8(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	MOVD b+16(FP), R0
+	loadBlock(0(R0), R5,R6,R7,R8)
+
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+
+	MOVD c+0(FP), R0
+	storeBlock( R9,R10,R11,R12,  0(R0))
+	storeBlock(R13,R14,R15,R16, 32(R0))
+	RET
+
+TEXT ·gfpAddWide(SB),0,$0-24
+	MOVD a+8(FP), R0
+	loadBlock( 0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	MOVD b+16(FP), R0
+	loadBlock( 0(R0),  R9,R10,R11,R12)
+	loadBlock(32(R0), R13,R14,R15,R16)
+	MOVD ZR, R0
+
+	ADDS  R9, R1
+	ADCS R10, R2
+	ADCS R11, R3
+	ADCS R12, R4
+	ADCS R13, R5
+	ADCS R14, R6
+	ADCS R15, R7
+	ADCS R16, R8
+	ADCS  ZR, R0
+
+	loadModulus(R9,R10,R11,R12)
+	SUBS  R9, R5, R9
+	SBCS R10, R6, R10
+	SBCS R11, R7, R11
+	SBCS R12, R8, R12
+	SBCS  ZR, R0, R0
+
+	CSEL CS,  R9, R5, R5
+	CSEL CS, R10, R6, R6
+	CSEL CS, R11, R7, R7
+	CSEL CS, R12, R8, R8
+
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4,  0(R0))
+	storeBlock(R5,R6,R7,R8, 32(R0))
+	RET
+
+TEXT ·gfpSubWide(SB),0,$0-24
+	MOVD a+8(FP), R0
+	loadBlock( 0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	MOVD b+16(FP), R0
+	loadBlock( 0(R0),  R9,R10,R11,R12)
+	loadBlock(32(R0), R13,R14,R15,R16)
+
+	gfpSubWideRegs(R1,R2,R3,R4,R5,R6,R7,R8, R9,R10,R11,R12,R13,R14,R15,R16)
+
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4,  0(R0))
+	storeBlock(R5,R6,R7,R8, 32(R0))
+	RET
+
+TEXT ·gfpReduceWide(SB),0,$0-16
+	MOVD a+8(FP), R0
+	loadBlock( 0(R0),  R9,R10,R11,R12)
+	loadBlock(32(R0), R13,R14,R15,R16)
+
+	gfpReduce()
+
+	MOVD c+0(FP), R0
+	storeBlock(R1,R2,R3,R4, 0(R0))
+	RET
+
+TEXT ·gfp2MulNoReduce(SB),0,$200-24
+	// Karatsuba multiplication as in gfp2Mul, but the products and their
+	// differences are left unreduced.
+	MOVD a+8(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	gfpAddRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	storeBlock(R1,R2,R3,R4, 8(RSP))
+
+	MOVD b+16(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	loadBlock(32(R0), R5,R6,R7,R8)
+	gfpAddRegs(R1,R2,R3,R4, R5,R6,R7,R8)
+	storeBlock(R1,R2,R3,R4, 40(RSP))
+
+	MOVD a+8(FP), R0
+	loadBlock(32(R0), R1,R2,R3,R4)
+	MOVD b+16(FP), R0
+	loadBlock(32(R0), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+	storeBlock( R9,R10,R11,R12,  72(RSP))
+	storeBlock(R13,R14,R15,R16, 104(RSP))
+
+	MOVD a+8(FP), R0
+	loadBlock(0(R0), R1,R2,R3,R4)
+	MOVD b+16(FP), R0
+	loadBlock(0(R0), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+	storeBlock( R9,R10,R11,R12, 136(RSP))
+	storeBlock(R13,R14,R15,R16, 168(RSP))
+
+	loadBlock(8(RSP), R1,R2,R3,R4)
+	loadBlock(40(RSP), R5,R6,R7,R8)
+	mul(R9,R10,R11,R12,R13,R14,R15,R16)
+
+	loadBlock( 72(RSP), R1,R2,R3,R4)
+	loadBlock(104(RSP), R5,R6,R7,R8)
+	gfpSubWideRegs(R9,R10,R11,R12,R13,R14,R15,R16, R1,R2,R3,R4,R5,R6,R7,R8)
+	loadBlock(136(RSP), R1,R2,R3,R4)
+	loadBlock(168(RSP), R5,R6,R7,R8)
+	gfpSubWideRegs(R9,R10,R11,R12,R13,R14,R15,R16, R1,R2,R3,R4,R5,R6,R7,R8)
+	MOVD c+0(FP), R0
+	storeBlock( R9,R10,R11,R12,  0(R0))
+	storeBlock(R13,R14,R15,R16, 32(R0))
+
+	loadBlock( 72(RSP),  R9,R10,R11,R12)
+	loadBlock(104(RSP), R13,R14,R15,R16)
+	loadBlock(136(RSP), R1,R2,R3,R4)
+	loadBlock(168(RSP), R5,R6,R7,R8)
+	gfpSubWideRegs(R9,R10,R11,R12,R13,R14,R15,R16, R1,R2,R3,R4,R5,R6,R7,R8)
+	MOVD c+0(FP), R0
+	storeBlock( R9,R10,R11,R12, 64(R0))
+	storeBlock(R13,R14,R15,R16, 96(R0))
+	RET
@@ -11,7 +11,11 @@ import (
 
 var hasBMI2 = cpu.X86.HasBMI2
 
-// go:noescape
+// hasADX enables the MULX/ADCX/ADOX multiplication, which needs both BMI2 and
+// ADX.
+var hasADX = cpu.X86.HasADX && cpu.X86.HasBMI2
+
+//go:noescape
 func gfpNeg(c, a *gfP)
 
 //go:noescape
@@ -22,3 +26,27 @@ func gfpSub(c, a, b *gfP)
 
 //go:noescape
 func gfpMul(c, a, b *gfP)
+
+//go:noescape
+func gfpSqr(c, a *gfP)
+
+//go:noescape
+func gfp2Mul(c, a, b *gfP2)
+
+//go:noescape
+func gfp2Sqr(c, a *gfP2)
+
+//go:noescape
+func gfpMulNoReduce(c *gfPWide, a, b *gfP)
+
+//go:noescape
+func gfpAddWide(c, a, b *gfPWide)
+
+//go:noescape
+func gfpSubWide(c, a, b *gfPWide)
+
+//go:noescape
+func gfpReduceWide(c *gfP, a *gfPWide)
+
+//go:noescape
+func gfp2MulNoReduce(c *gfP2Wide, a, b *gfP2)
@@ -155,8 +155,70 @@ func halfMul(a, b [4]uint64) [4]uint64 {
 	return [4]uint64{buff[0], buff[4], buff[8], buff[12]}
 }
 
-func gfpMul(c, a, b *gfP) {
-	T := mul(*a, *b)
+// sqr computes a² like mul(a, a), but only computes each cross product aᵢaⱼ
+// with i≠j once and doubles it.
+func sqr(a [4]uint64) [8]uint64 {
+	const (
+		mask16 uint64 = 0x0000ffff
+		mask32 uint64 = 0xffffffff
+	)
+
+	var buff [32]uint64
+	for i, ai := range a {
+		a0, a1, a2, a3 := ai&mask16, (ai>>16)&mask16, (ai>>32)&mask16, ai>>48
+
+		for j := i + 1; j < 4; j++ {
+			b0, b2 := a[j]&mask32, a[j]>>32
+
+			off := 4 * (i + j)
+			buff[off+0] += a0 * b0
+			buff[off+1] += a1 * b0
+			buff[off+2] += a2*b0 + a0*b2
+			buff[off+3] += a3*b0 + a1*b2
+			buff[off+4] += a2 * b2
+			buff[off+5] += a3 * b2
+		}
+	}
+
+	for i := range buff {
+		buff[i] <<= 1
+	}
+
+	for i, ai := range a {
+		a0, a1, a2, a3 := ai&mask16, (ai>>16)&mask16, (ai>>32)&mask16, ai>>48
+		b0, b2 := ai&mask32, ai>>32
+
+		off := 8 * i
+		buff[off+0] += a0 * b0
+		buff[off+1] += a1 * b0
+		buff[off+2] += a2*b0 + a0*b2
+		buff[off+3] += a3*b0 + a1*b2
+		buff[off+4] += a2 * b2
+		buff[off+5] += a3 * b2
+	}
+
+	for i := uint(1); i < 4; i++ {
+		shift := 16 * i
+
+		var head, carry uint64
+		for j := uint(0); j < 8; j++ {
+			block := 4 * j
+
+			xi := buff[block]
+			yi := (buff[block+i] << shift) + head
+			zi := xi + yi + carry
+			buff[block] = zi
+			carry = (xi&yi | (xi|yi)&^zi) >> 63
+
+			head = buff[block+i] >> (64 - shift)
+		}
+	}
+
+	return [8]uint64{buff[0], buff[4], buff[8], buff[12], buff[16], buff[20], buff[24], buff[28]}
+}
+
+// gfpReduce sets c to the Montgomery reduction T·R⁻¹ of the 512-bit value T.
+func gfpReduce(c *gfP, T [8]uint64) {
 	m := halfMul([4]uint64{T[0], T[1], T[2], T[3]}, np)
 	t := mul([4]uint64{m[0], m[1], m[2], m[3]}, p2)
 
@@ -171,3 +233,102 @@ func gfpMul(c, a, b *gfP) {
 	*c = gfP{T[4], T[5], T[6], T[7]}
 	gfpCarry(c, carry)
 }
+
+func gfpMul(c, a, b *gfP) {
+	gfpReduce(c, mul(*a, *b))
+}
+
+// gfpMulVecBlocks leaves all the products of gfpMulVec to gfpMul.
+func gfpMulVecBlocks(c, a, b []gfP) int {
+	return 0
+}
+
+func gfpSqr(c, a *gfP) {
+	gfpReduce(c, sqr(*a))
+}
+
+func gfp2Mul(c, a, b *gfP2) {
+	// Karatsuba multiplication: with v0 = a.y*b.y and v1 = a.x*b.x,
+	// c.x = (a.x+a.y)(b.x+b.y) - v0 - v1 and c.y = v0 - v1.
+	sa, sb, v0, v1 := &gfP{}, &gfP{}, &gfP{}, &gfP{}
+	gfpAdd(sa, &a.x, &a.y)
+	gfpAdd(sb, &b.x, &b.y)
+	gfpMul(v0, &a.y, &b.y)
+	gfpMul(v1, &a.x, &b.x)
+
+	gfpMul(sa, sa, sb)
+	gfpSub(sa, sa, v0)
+	gfpSub(&c.x, sa, v1)
+	gfpSub(&c.y, v0, v1)
+}
+
+func gfp2Sqr(c, a *gfP2) {
+	// Complex squaring: (xi+y)² = (y-x)(y+x) + 2*i*x*y
+	tx, ty := &gfP{}, &gfP{}
+	gfpSub(tx, &a.y, &a.x)
+	gfpAdd(ty, &a.x, &a.y)
+	gfpMul(ty, tx, ty)
+
+	gfpMul(tx, &a.x, &a.y)
+	gfpAdd(&c.x, tx, tx)
+	c.y.Set(ty)
+}
+
+func gfpMulNoReduce(c *gfPWide, a, b *gfP) {
+	*c = mul(*a, *b)
+}
+
+func gfpAddWide(c, a, b *gfPWide) {
+	var carry uint64
+	for i, ai := range a {
+		bi := b[i]
+		ci := ai + bi + carry
+		c[i] = ci
+		carry = (ai&bi | (ai|bi)&^ci) >> 63
+	}
+
+	// Only the high half has to be reduced, modulo p·2²⁵⁶.
+	high := &gfP{c[4], c[5], c[6], c[7]}
+	gfpCarry(high, carry)
+	copy(c[4:], high[:])
+}
+
+func gfpSubWide(c, a, b *gfPWide) {
+	var carry uint64
+	for i, ai := range a {
+		bi := b[i]
+		ci := ai - bi - carry
+		c[i] = ci
+		carry = (bi&^ai | (bi|^ai)&ci) >> 63
+	}
+
+	// If the difference is negative, add p·2²⁵⁶.
+	mask := -carry
+	carry = 0
+	for i, pi := range p2 {
+		pi &= mask
+		ci := c[4+i]
+		zi := ci + pi + carry
+		c[4+i] = zi
+		carry = (ci&pi | (ci|pi)&^zi) >> 63
+	}
+}
+
+func gfpReduceWide(c *gfP, a *gfPWide) {
+	gfpReduce(c, *a)
+}
+
+func gfp2MulNoReduce(c *gfP2Wide, a, b *gfP2) {
+	// Karatsuba multiplication as in gfp2Mul, but the products and their
+	// differences are left unreduced.
+	sa, sb, v0, v1 := &gfP{}, &gfP{}, &gfPWide{}, &gfPWide{}
+	gfpAdd(sa, &a.x, &a.y)
+	gfpAdd(sb, &b.x, &b.y)
+	gfpMulNoReduce(v0, &a.y, &b.y)
+	gfpMulNoReduce(v1, &a.x, &b.x)
+
+	gfpMulNoReduce(&c.x, sa, sb)
+	gfpSubWide(&c.x, &c.x, v0)
+	gfpSubWide(&c.x, &c.x, v1)
+	gfpSubWide(&c.y, v0, v1)
+}
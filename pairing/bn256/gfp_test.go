@@ -0,0 +1,319 @@
+package bn256
+
+import (
+	"math/big"
+	"testing"
+
+	"go.dedis.ch/kyber/v3/util/random"
+)
+
+// randomGFp returns a uniformly random field element in Montgomery form.
+func randomGFp() *gfP {
+	buf := make([]byte, 32)
+	n := random.Int(p, random.New()).Bytes()
+	copy(buf[32-len(n):], n)
+
+	e := &gfP{}
+	e.Unmarshal(buf)
+	montEncode(e, e)
+	return e
+}
+
+// gfpToBig returns the canonical integer represented by e.
+func gfpToBig(e *gfP) *big.Int {
+	buf := make([]byte, 32)
+	t := &gfP{}
+	montDecode(t, e)
+	t.Marshal(buf)
+	return new(big.Int).SetBytes(buf)
+}
+
+func TestGFpMarshal(t *testing.T) {
+	buf := make([]byte, 32)
+	for i := 0; i < 100; i++ {
+		a := randomGFp()
+		a.Marshal(buf)
+		want := new(big.Int)
+		for j := len(a) - 1; j >= 0; j-- {
+			want.Lsh(want, 64).Or(want, new(big.Int).SetUint64(a[j]))
+		}
+		if got := new(big.Int).SetBytes(buf); got.Cmp(want) != 0 {
+			t.Fatalf("marshal of %v: got %x", a, got)
+		}
+
+		// Unmarshal overwrites the destination.
+		b := &gfP{^uint64(0), ^uint64(0), ^uint64(0), ^uint64(0)}
+		b.Unmarshal(buf)
+		if *b != *a {
+			t.Fatalf("unmarshal of %x: got %v, want %v", buf, b, a)
+		}
+	}
+}
+
+func TestGFpSqr(t *testing.T) {
+	for i := 0; i < 1000; i++ {
+		a := randomGFp()
+		want, got := &gfP{}, &gfP{}
+		gfpMul(want, a, a)
+		gfpSqr(got, a)
+		if *want != *got {
+			t.Fatalf("gfpSqr(%s) = %s, want %s", a, got, want)
+		}
+
+		exp := gfpToBig(a)
+		exp.Mul(exp, exp).Mod(exp, p)
+		if gfpToBig(got).Cmp(exp) != 0 {
+			t.Fatalf("gfpSqr(%s) does not match math/big", a)
+		}
+	}
+
+	// Check the edge cases where every limb is at its maximum.
+	pm1 := &gfP{}
+	gfpSub(pm1, &gfP{0}, newGFp(1))
+	want, got := &gfP{}, &gfP{}
+	gfpMul(want, pm1, pm1)
+	gfpSqr(got, pm1)
+	if *want != *got {
+		t.Fatalf("gfpSqr(p-1) = %s, want %s", got, want)
+	}
+}
+
+func TestGFpMulVec(t *testing.T) {
+	// The largest representation, p-1, and small ones.
+	edges := []gfP{{p2[0] - 1, p2[1], p2[2], p2[3]}, {}, {1}, *newGFp(1), *newGFp(-1)}
+	for _, n := range []int{0, 1, 7, 8, 9, 16, 23, 64, 100} {
+		a, b := make([]gfP, n), make([]gfP, n)
+		for i := range a {
+			a[i], b[i] = *randomGFp(), *randomGFp()
+			if i < len(edges) {
+				a[i], b[len(b)-1-i] = edges[i], edges[i]
+			}
+		}
+		if n >= 16 {
+			// Both operands at p-1.
+			a[15], b[15] = edges[0], edges[0]
+		}
+
+		c := make([]gfP, n)
+		gfpMulVec(c, a, b)
+		for i := range c {
+			want := &gfP{}
+			gfpMul(want, &a[i], &b[i])
+			if c[i] != *want {
+				t.Fatalf("n = %d: gfpMulVec(%s, %s) = %s, want %s", n, &a[i], &b[i], &c[i], want)
+			}
+		}
+
+		// The result may replace an operand.
+		gfpMulVec(a, a, b)
+		for i := range a {
+			if a[i] != c[i] {
+				t.Fatalf("n = %d: aliased gfpMulVec = %s, want %s", n, &a[i], &c[i])
+			}
+		}
+	}
+}
+
+func TestGFpInvert(t *testing.T) {
+	for _, a := range []*gfP{newGFp(1), newGFp(-1), randomGFp(), randomGFp(), randomGFp()} {
+		got := &gfP{}
+		got.Invert(a)
+		want := new(big.Int).ModInverse(gfpToBig(a), p)
+		if gfpToBig(got).Cmp(want) != 0 {
+			t.Fatalf("Invert(%s) = %s, want %x", a, got, want)
+		}
+
+		got.Set(a)
+		got.Invert(got)
+		if gfpToBig(got).Cmp(want) != 0 {
+			t.Fatalf("aliased Invert(%s) = %s, want %x", a, got, want)
+		}
+	}
+}
+
+func TestGFpSqrt(t *testing.T) {
+	for i := 0; i < 100; i++ {
+		a := randomGFp()
+		got := &gfP{}
+		ok := got.Sqrt(a)
+		want := new(big.Int).ModSqrt(gfpToBig(a), p)
+		if ok != (want != nil) {
+			t.Fatalf("Sqrt(%s) = %v, want %v", a, ok, want != nil)
+		}
+		if !ok {
+			continue
+		}
+
+		// The roots are ±want, so compare the squares.
+		sq := &gfP{}
+		gfpSqr(sq, got)
+		if *sq != *a {
+			t.Fatalf("Sqrt(%s)² = %s", a, sq)
+		}
+	}
+
+	got := randomGFp()
+	gfpSqr(got, got)
+	if !got.Sqrt(got) {
+		t.Fatal("aliased Sqrt of a square = false")
+	}
+
+	if !got.Sqrt(&gfP{}) || *got != (gfP{}) {
+		t.Fatalf("Sqrt(0) = %s", got)
+	}
+}
+
+func randomGFp2() *gfP2 {
+	return &gfP2{*randomGFp(), *randomGFp()}
+}
+
+func TestGFp2Sqrt(t *testing.T) {
+	for i := 0; i < 100; i++ {
+		a := randomGFp2()
+		if i%10 == 0 {
+			a.x = gfP{0}
+		}
+
+		// a is a square iff its norm x²+y² is a square in GF(p).
+		norm := new(big.Int).Mul(gfpToBig(&a.x), gfpToBig(&a.x))
+		norm.Add(norm, new(big.Int).Mul(gfpToBig(&a.y), gfpToBig(&a.y)))
+		isSquare := big.Jacobi(norm.Mod(norm, p), p) >= 0
+
+		got := &gfP2{}
+		if ok := got.Sqrt(a); ok != isSquare {
+			t.Fatalf("Sqrt(%s) = %v, want %v", a, ok, isSquare)
+		} else if !ok {
+			continue
+		}
+		sq := (&gfP2{}).Square(got)
+		if *sq != *a {
+			t.Fatalf("Sqrt(%s)² = %s", a, sq)
+		}
+	}
+}
+
+func TestGFp2MulSqr(t *testing.T) {
+	for i := 0; i < 1000; i++ {
+		a, b := randomGFp2(), randomGFp2()
+
+		// Schoolbook (xi+y)(zi+w) = (xw+yz)i + (yw-xz)
+		want, t0 := &gfP2{}, &gfP{}
+		gfpMul(&want.x, &a.x, &b.y)
+		gfpMul(t0, &a.y, &b.x)
+		gfpAdd(&want.x, &want.x, t0)
+		gfpMul(&want.y, &a.y, &b.y)
+		gfpMul(t0, &a.x, &b.x)
+		gfpSub(&want.y, &want.y, t0)
+
+		got := (&gfP2{}).Mul(a, b)
+		if *got != *want {
+			t.Fatalf("gfP2.Mul(%s, %s) = %s, want %s", a, b, got, want)
+		}
+
+		// Check aliasing of the output with the inputs.
+		got.Set(a).Mul(got, b)
+		if *got != *want {
+			t.Fatalf("aliased gfP2.Mul(%s, %s) = %s, want %s", a, b, got, want)
+		}
+
+		want.Mul(a, a)
+		got.Set(a).Square(got)
+		if *got != *want {
+			t.Fatalf("gfP2.Square(%s) = %s, want %s", a, got, want)
+		}
+	}
+}
+
+func TestGFpWide(t *testing.T) {
+	pm1 := &gfP{}
+	gfpSub(pm1, &gfP{0}, newGFp(1))
+
+	for i := 0; i < 1000; i++ {
+		a, b, c := randomGFp(), randomGFp(), randomGFp()
+		if i == 0 {
+			// Maximal products exercise the carries out of the high half.
+			a, b, c = pm1, pm1, pm1
+		}
+
+		// want = a·b + a·c - b·c + a·b, computed with reduced arithmetic.
+		want, t0 := &gfP{}, &gfP{}
+		gfpMul(want, a, b)
+		gfpMul(t0, a, c)
+		gfpAdd(want, want, t0)
+		gfpMul(t0, b, c)
+		gfpSub(want, want, t0)
+		gfpMul(t0, a, b)
+		gfpAdd(want, want, t0)
+
+		w, tw := &gfPWide{}, &gfPWide{}
+		gfpMulNoReduce(w, a, b)
+		gfpMulNoReduce(tw, a, c)
+		gfpAddWide(w, w, tw)
+		gfpMulNoReduce(tw, b, c)
+		gfpSubWide(w, w, tw)
+		gfpMulNoReduce(tw, a, b)
+		gfpAddWide(w, w, tw)
+
+		got := &gfP{}
+		gfpReduceWide(got, w)
+		if *got != *want {
+			t.Fatalf("wide accumulation of %s, %s, %s = %s, want %s", a, b, c, got, want)
+		}
+	}
+}
+
+func randomGFp6() *gfP6 {
+	return &gfP6{*randomGFp2(), *randomGFp2(), *randomGFp2()}
+}
+
+func TestGFp6Mul(t *testing.T) {
+	for i := 0; i < 100; i++ {
+		a, b := randomGFp6(), randomGFp6()
+
+		// Schoolbook multiplication modulo τ³=ξ.
+		want, t0 := &gfP6{}, &gfP2{}
+		want.z.Mul(&a.z, &b.z)
+		t0.Mul(&a.x, &b.y)
+		want.z.Add(&want.z, t0.MulXi(t0))
+		t0.Mul(&a.y, &b.x)
+		want.z.Add(&want.z, t0.MulXi(t0))
+
+		want.y.Mul(&a.y, &b.z)
+		t0.Mul(&a.z, &b.y)
+		want.y.Add(&want.y, t0)
+		t0.Mul(&a.x, &b.x)
+		want.y.Add(&want.y, t0.MulXi(t0))
+
+		want.x.Mul(&a.x, &b.z)
+		t0.Mul(&a.y, &b.y)
+		want.x.Add(&want.x, t0)
+		t0.Mul(&a.z, &b.x)
+		want.x.Add(&want.x, t0)
+
+		got := (&gfP6{}).Mul(a, b)
+		if *got != *want {
+			t.Fatalf("gfP6.Mul(%s, %s) = %s, want %s", a, b, got, want)
+		}
+	}
+}
+
+func TestGFp12CyclotomicSquare(t *testing.T) {
+	a := (&gfP12{}).Set(gfP12Gen)
+	for i := 0; i < 100; i++ {
+		want := (&gfP12{}).Square(a)
+		got := (&gfP12{}).CyclotomicSquare(a)
+		if *got != *want {
+			t.Fatalf("CyclotomicSquare(%s) = %s, want %s", a, got, want)
+		}
+		a.Mul(a, gfP12Gen)
+	}
+
+	// The final exponentiation maps any element into the cyclotomic
+	// subgroup.
+	a = finalExponentiation(a, &gfP12{*randomGFp6(), *randomGFp6()})
+	want := (&gfP12{}).Exp(a, u)
+	got := (&gfP12{}).CyclotomicExp(a, u)
+	if *got != *want {
+		t.Fatalf("CyclotomicExp(%s, u) = %s, want %s", a, got, want)
+	}
+}
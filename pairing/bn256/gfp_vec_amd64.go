@@ -0,0 +1,64 @@
+// +build amd64,!generic
+
+package bn256
+
+// hasIFMA enables the AVX-512 IFMA kernel of gfpMulVec. The version of
+// x/sys/cpu that kyber requires does not report AVX-512, so it is detected
+// here, with the support of the OS for the opmask and ZMM registers.
+var hasIFMA = detectIFMA()
+
+func detectIFMA() bool {
+	maxID, _, _, _ := cpuid(0, 0)
+	if maxID < 7 {
+		return false
+	}
+	const osxsave = 1 << 27
+	if _, _, ecx, _ := cpuid(1, 0); ecx&osxsave == 0 {
+		return false
+	}
+	// XCR0 must enable the SSE, AVX, opmask, ZMM_Hi256 and Hi16_ZMM states.
+	if xcr0, _ := xgetbv(); xcr0&0xe6 != 0xe6 {
+		return false
+	}
+	const avx512F, avx512IFMA = 1 << 16, 1 << 21
+	_, ebx, _, _ := cpuid(7, 0)
+	return ebx&avx512F != 0 && ebx&avx512IFMA != 0
+}
+
+// p52 is p in 52-bit limbs, and np52 is -p⁻¹ mod 2⁵², for gfpMulIFMA.
+var (
+	p52  = [5]uint64{0xcac6c5e089667, 0xd120b5b59e185, 0x184dc21ee5b88, 0x87f9aa6fecb86, 0x8fb501e34aa3}
+	np52 = uint64(0x7f9007f17daa9)
+)
+
+// ifmaTranspose holds the two VPERMT2Q indices that gfpMulIFMA uses to
+// transpose eight field elements between their 64-bit limbs in memory and one
+// register per limb.
+var ifmaTranspose = [16]uint64{0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15}
+
+// gfpMulVecBlocks multiplies the longest prefix of a and b whose length is a
+// multiple of eight with gfpMulIFMA if the CPU supports it, and returns the
+// length of the prefix.
+func gfpMulVecBlocks(c, a, b []gfP) int {
+	n := len(c) &^ 7
+	if !hasIFMA || n == 0 {
+		return 0
+	}
+	gfpMulIFMA(&c[0], &a[0], &b[0], n)
+	return n
+}
+
+func cpuid(eaxArg, ecxArg uint32) (eax, ebx, ecx, edx uint32)
+
+func xgetbv() (eax, edx uint32)
+
+// gfpMulIFMA sets c[i] = a[i]*b[i] for the n elements of each array, where n
+// is a positive multiple of eight. The elements are converted to five 52-bit
+// limbs, and each group of eight is multiplied at once, one element per lane
+// of the AVX-512 registers, with Montgomery multiplication in radix 2⁵². a is
+// shifted left by 4 bits on conversion so that the reduction by 2²⁶⁰ yields
+// a·b/R with R = 2²⁵⁶ like gfpMul. Since p < 0.57·2²⁵⁶, the unreduced result
+// (2⁴a·b + m·p)/2²⁶⁰ is below 1.57p and needs one conditional subtraction.
+//
+//go:noescape
+func gfpMulIFMA(c, a, b *gfP, n int)
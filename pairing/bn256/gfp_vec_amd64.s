@@ -0,0 +1,218 @@
+// +build amd64,!generic
+
+// The AVX-512 IFMA multiplication of gfpMulVec. Eight field elements are
+// processed at once, one per 64-bit lane: limb j of the eight elements is in
+// one register. The registers are
+//
+//	Z0-Z4    a in 52-bit limbs, times 2⁴
+//	Z5-Z9    b in 52-bit limbs
+//	Z10-Z15  the accumulator, whose limbs rotate by one each round
+//	Z16      the Montgomery factor m of a round
+//	Z17-Z22  temporaries
+//	Z23-Z24  the indices of ifmaTranspose
+//	Z25-Z29  p in 52-bit limbs
+//	Z30      -p⁻¹ mod 2⁵²
+//	Z31      2⁵²-1
+
+#define mask52 Z31
+
+// transposeIn loads the eight elements at r and leaves their limbs in
+// Z19-Z22. The first step gathers the limbs of four elements into halves of
+// Z21-Z22 and Z17-Z18, the second joins the halves.
+#define transposeIn(r) \
+	VMOVDQU64   0+r, Z17 \
+	VMOVDQU64  64+r, Z18 \
+	VMOVDQU64 128+r, Z19 \
+	VMOVDQU64 192+r, Z20 \
+	VMOVDQA64 Z17, Z21 \
+	VPERMT2Q  Z18, Z23, Z21 \
+	VMOVDQA64 Z17, Z22 \
+	VPERMT2Q  Z18, Z24, Z22 \
+	VMOVDQA64 Z19, Z17 \
+	VPERMT2Q  Z20, Z23, Z17 \
+	VMOVDQA64 Z19, Z18 \
+	VPERMT2Q  Z20, Z24, Z18 \
+	VSHUFI64X2 $0x44, Z17, Z21, Z19 \
+	VSHUFI64X2 $0xee, Z17, Z21, Z20 \
+	VSHUFI64X2 $0x44, Z18, Z22, Z21 \
+	VSHUFI64X2 $0xee, Z18, Z22, Z22
+
+// transposeOut stores the eight elements whose limbs are in Z19-Z22 to r.
+#define transposeOut(r) \
+	VSHUFI64X2 $0x44, Z20, Z19, Z17 \
+	VSHUFI64X2 $0xee, Z20, Z19, Z18 \
+	VSHUFI64X2 $0x44, Z22, Z21, Z19 \
+	VSHUFI64X2 $0xee, Z22, Z21, Z20 \
+	VMOVDQA64 Z17, Z21 \
+	VPERMT2Q  Z19, Z23, Z21 \
+	VPERMT2Q  Z19, Z24, Z17 \
+	VMOVDQA64 Z18, Z22 \
+	VPERMT2Q  Z20, Z23, Z22 \
+	VPERMT2Q  Z20, Z24, Z18 \
+	VMOVDQU64 Z21,   0+r \
+	VMOVDQU64 Z17,  64+r \
+	VMOVDQU64 Z22, 128+r \
+	VMOVDQU64 Z18, 192+r
+
+// limb52 sets r to the 52 bits of the 128-bit xn:x from bit k of x, where
+// kn = 64-k, with the temporary t.
+#define limb52(x, xn, k, kn, r, t) \
+	VPSRLQ k, x, r \
+	VPSLLQ kn, xn, t \
+	VPORQ  t, r, r \
+	VPANDQ mask52, r, r
+
+// toLimbs52 converts the limbs in Z19-Z22 to the five 52-bit limbs r0-r4 of
+// the element shifted left by s bits. The other arguments are the positions
+// of limbs 1-4 in Z19-Z22, which depend on s.
+#define toLimbs52(s, r0,r1,r2,r3,r4, k1,kn1, k2,kn2, k3,kn3, k4) \
+	VPSLLQ s, Z19, r0 \
+	VPANDQ mask52, r0, r0 \
+	limb52(Z19, Z20, k1, kn1, r1, Z17) \
+	limb52(Z20, Z21, k2, kn2, r2, Z17) \
+	limb52(Z21, Z22, k3, kn3, r3, Z17) \
+	VPSRLQ k4, Z22, r4
+
+// round adds a·b to the accumulator t0:...:t5 for one limb a of a, then
+// adds m·p for the m that clears the low 52 bits of t0, and shifts t0 out.
+// t5 must be zero on entry, and t0 is on exit.
+#define round(a, t0,t1,t2,t3,t4,t5) \
+	VPMADD52LUQ Z5, a, t0 \
+	VPMADD52HUQ Z5, a, t1 \
+	VPMADD52LUQ Z6, a, t1 \
+	VPMADD52HUQ Z6, a, t2 \
+	VPMADD52LUQ Z7, a, t2 \
+	VPMADD52HUQ Z7, a, t3 \
+	VPMADD52LUQ Z8, a, t3 \
+	VPMADD52HUQ Z8, a, t4 \
+	VPMADD52LUQ Z9, a, t4 \
+	VPMADD52HUQ Z9, a, t5 \
+	\
+	VPXORQ Z16, Z16, Z16 \
+	VPMADD52LUQ Z30, t0, Z16 \
+	\
+	VPMADD52LUQ Z25, Z16, t0 \
+	VPMADD52HUQ Z25, Z16, t1 \
+	VPMADD52LUQ Z26, Z16, t1 \
+	VPMADD52HUQ Z26, Z16, t2 \
+	VPMADD52LUQ Z27, Z16, t2 \
+	VPMADD52HUQ Z27, Z16, t3 \
+	VPMADD52LUQ Z28, Z16, t3 \
+	VPMADD52HUQ Z28, Z16, t4 \
+	VPMADD52LUQ Z29, Z16, t4 \
+	VPMADD52HUQ Z29, Z16, t5 \
+	\
+	VPSRLQ $52, t0, t0 \
+	VPADDQ t0, t1, t1 \
+	VPXORQ t0, t0, t0
+
+// carry52 moves the bits of t above 52 to tn.
+#define carry52(t, tn) \
+	VPSRLQ $52, t, Z17 \
+	VPADDQ Z17, tn, tn \
+	VPANDQ mask52, t, t
+
+// borrow52 sets d to t-p for limb p of p and the borrow in Z17, and leaves
+// the new borrow in Z17.
+#define borrow52(t, p, d) \
+	VPSUBQ p, t, d \
+	VPADDQ Z17, d, d \
+	VPSRAQ $52, d, Z17 \
+	VPANDQ mask52, d, d
+
+// to64 sets r to a 64-bit limb of an element from its normalized 52-bit limbs
+// t and tn: the bits of t from k, and those of tn below 64-kn.
+#define to64(t, tn, k, kn, r) \
+	VPSRLQ k, t, r \
+	VPSLLQ kn, tn, Z17 \
+	VPORQ  Z17, r, r
+
+TEXT ·gfpMulIFMA(SB),0,$0-32
+	MOVQ c+0(FP), DI
+	MOVQ a+8(FP), SI
+	MOVQ b+16(FP), DX
+	MOVQ n+24(FP), CX
+	SHRQ $3, CX
+
+	MOVQ $0xfffffffffffff, AX
+	VPBROADCASTQ AX, mask52
+	VPBROADCASTQ ·np52(SB), Z30
+	VPBROADCASTQ ·p52+0(SB), Z25
+	VPBROADCASTQ ·p52+8(SB), Z26
+	VPBROADCASTQ ·p52+16(SB), Z27
+	VPBROADCASTQ ·p52+24(SB), Z28
+	VPBROADCASTQ ·p52+32(SB), Z29
+	VMOVDQU64 ·ifmaTranspose+0(SB), Z23
+	VMOVDQU64 ·ifmaTranspose+64(SB), Z24
+
+loop:
+	transposeIn(0(SI))
+	toLimbs52($4, Z0,Z1,Z2,Z3,Z4, $48,$16, $36,$28, $24,$40, $12)
+	transposeIn(0(DX))
+	toLimbs52($0, Z5,Z6,Z7,Z8,Z9, $52,$12, $40,$24, $28,$36, $16)
+
+	VPXORQ Z10, Z10, Z10
+	VPXORQ Z11, Z11, Z11
+	VPXORQ Z12, Z12, Z12
+	VPXORQ Z13, Z13, Z13
+	VPXORQ Z14, Z14, Z14
+	VPXORQ Z15, Z15, Z15
+	round(Z0, Z10,Z11,Z12,Z13,Z14,Z15)
+	round(Z1, Z11,Z12,Z13,Z14,Z15,Z10)
+	round(Z2, Z12,Z13,Z14,Z15,Z10,Z11)
+	round(Z3, Z13,Z14,Z15,Z10,Z11,Z12)
+	round(Z4, Z14,Z15,Z10,Z11,Z12,Z13)
+
+	// The product is Z15:Z10:Z11:Z12:Z13, below 2p. Normalize it, subtract
+	// p into Z0-Z4, and keep the product where the difference is negative.
+	carry52(Z15, Z10)
+	carry52(Z10, Z11)
+	carry52(Z11, Z12)
+	carry52(Z12, Z13)
+	VPXORQ Z17, Z17, Z17
+	borrow52(Z15, Z25, Z0)
+	borrow52(Z10, Z26, Z1)
+	borrow52(Z11, Z27, Z2)
+	borrow52(Z12, Z28, Z3)
+	borrow52(Z13, Z29, Z4)
+	VPTESTMQ Z17, Z17, K1
+	VMOVDQA64 Z15, K1, Z0
+	VMOVDQA64 Z10, K1, Z1
+	VMOVDQA64 Z11, K1, Z2
+	VMOVDQA64 Z12, K1, Z3
+	VMOVDQA64 Z13, K1, Z4
+
+	to64(Z0, Z1, $0, $52, Z19)
+	to64(Z1, Z2, $12, $40, Z20)
+	to64(Z2, Z3, $24, $28, Z21)
+	to64(Z3, Z4, $36, $16, Z22)
+	transposeOut(0(DI))
+
+	ADDQ $256, SI
+	ADDQ $256, DX
+	ADDQ $256, DI
+	DECQ CX
+	JNZ  loop
+
+	VZEROUPPER
+	RET
+
+// func cpuid(eaxArg, ecxArg uint32) (eax, ebx, ecx, edx uint32)
+TEXT ·cpuid(SB),0,$0-24
+	MOVL eaxArg+0(FP), AX
+	MOVL ecxArg+4(FP), CX
+	CPUID
+	MOVL AX, eax+8(FP)
+	MOVL BX, ebx+12(FP)
+	MOVL CX, ecx+16(FP)
+	MOVL DX, edx+20(FP)
+	RET
+
+// func xgetbv() (eax, edx uint32)
+TEXT ·xgetbv(SB),0,$0-8
+	MOVL $0, CX
+	// XGETBV, which older assemblers do not know.
+	BYTE $0x0f; BYTE $0x01; BYTE $0xd0
+	MOVL AX, eax+0(FP)
+	MOVL DX, edx+4(FP)
+	RET
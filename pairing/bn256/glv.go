@@ -0,0 +1,230 @@
+package bn256
+
+import (
+	"math/big"
+	"math/bits"
+)
+
+// This file contains the scalar decompositions and recodings used by the
+// scalar multiplications of curvePoint and twistPoint. Both groups have an
+// efficient endomorphism that acts as multiplication by a scalar λ of about
+// half the size of Order, which splits a scalar k into two halves with
+// k ≡ k1 + k2·λ. The two halves are then multiplied at the same time, which
+// halves the number of doublings.
+
+// glvLambda is the eigenvalue 36u³+18u²+6u+1 of φ(x, y) = (βx, y) on G₁, where
+// β = xiTo2PSquaredMinus2Over3 is a cube root of unity.
+var glvLambda = bigFromBase10("9971566668618268521530616648191882281418254099768607949373")
+
+// glvA1, glvB1, glvA2 and glvB2 are the short basis (a1, b1) = (2u+1,
+// -(6u²+2u)) and (a2, b2) = (6u²+4u+1, 2u+1) of the lattice of vectors with
+// a + b·λ ≡ 0 mod Order.
+var (
+	glvA1 = bigFromBase10("13037178982157583875")
+	glvB1 = bigFromBase10("-254952053719217182009119236802174855688")
+	glvA2 = bigFromBase10("254952053719217182022156415784332439563")
+	glvB2 = bigFromBase10("13037178982157583875")
+)
+
+// psiLambda is the eigenvalue 6u² = p mod Order of the endomorphism ψ of the
+// twist on G₂ that untwists, applies the Frobenius and twists back.
+var psiLambda = bigFromBase10("254952053719217181996082057820017271814")
+
+// glvDecompose returns k1 and k2 with k ≡ k1 + k2·glvLambda mod Order and
+// |k1|, |k2| < 2^128.
+func glvDecompose(k *big.Int) (k1, k2 *big.Int) {
+	k = new(big.Int).Mod(k, Order)
+
+	// Round the coordinates of (k, 0) in the basis to the nearest integers:
+	// c1 = ⌊b2·k/n⌉ and c2 = ⌊-b1·k/n⌉, where the determinant of the basis is
+	// n = Order.
+	round := func(b *big.Int) *big.Int {
+		c := new(big.Int).Mul(b, k)
+		c.Lsh(c, 1).Add(c, Order)
+		return c.Quo(c, new(big.Int).Lsh(Order, 1))
+	}
+	c1 := round(glvB2)
+	c2 := round(new(big.Int).Neg(glvB1))
+
+	// (k1, k2) = (k, 0) - c1·(a1, b1) - c2·(a2, b2)
+	t := &big.Int{}
+	k1 = new(big.Int).Sub(k, t.Mul(c1, glvA1))
+	k1.Sub(k1, t.Mul(c2, glvA2))
+	k2 = new(big.Int).Neg(t.Mul(c1, glvB1))
+	k2.Sub(k2, t.Mul(c2, glvB2))
+	return k1, k2
+}
+
+// psiDecompose returns k1 and k2 with k ≡ k1 + k2·psiLambda mod Order and
+// 0 ≤ k1, k2 < 2^128.
+func psiDecompose(k *big.Int) (k1, k2 *big.Int) {
+	k = new(big.Int).Mod(k, Order)
+	k2, k1 = new(big.Int).QuoRem(k, psiLambda, new(big.Int))
+	return k1, k2
+}
+
+const (
+	// mulWindow is the window size of the scalar multiplications, which use
+	// tables of the mulTableSize odd multiples P, 3P, ..., (2^mulWindow-1)P.
+	mulWindow    = 4
+	mulTableSize = 1 << (mulWindow - 1)
+
+	// mulDigits is the number of digits of the regular recoding of a scalar
+	// below 2^130.
+	mulDigits = 130/mulWindow + 1
+)
+
+// halfScalar is a non-negative scalar below 2^192 as little-endian words.
+type halfScalar [3]uint64
+
+func newHalfScalar(k *big.Int) halfScalar {
+	var h halfScalar
+	buf := k.Bytes()
+	for i := range buf {
+		b := uint64(buf[len(buf)-1-i])
+		h[i/8] |= b << (8 * uint(i%8))
+	}
+	return h
+}
+
+func (h *halfScalar) shiftRight(n uint) {
+	h[0] = h[0]>>n | h[1]<<(64-n)
+	h[1] = h[1]>>n | h[2]<<(64-n)
+	h[2] >>= n
+}
+
+// recodeRegular writes the odd h < 2^130 as the sum of dᵢ·2^(mulWindow·i)
+// where every digit dᵢ is odd and |dᵢ| < 2^mulWindow. Since no digit is zero,
+// the multiplication does the same operations for every scalar; see "Exponent
+// Recoding and Regular Exponentiation Algorithms", Joye and Tunstall.
+func recodeRegular(h halfScalar) (d [mulDigits]int8) {
+	const mask = 1<<(mulWindow+1) - 1
+	for i := 0; i < mulDigits-1; i++ {
+		d[i] = int8(h[0]&mask) - 1<<mulWindow
+
+		// h = (h - dᵢ) / 2^mulWindow, which is odd again.
+		h.shiftRight(mulWindow)
+		h[0] |= 1
+	}
+	d[mulDigits-1] = int8(h[0])
+	return d
+}
+
+// recodeWNAF returns the width-(mulWindow+1) non-adjacent form of h, least
+// significant digit first. Its non-zero digits are odd with |dᵢ| <
+// 2^mulWindow and are separated by at least mulWindow zeros.
+func recodeWNAF(h halfScalar) []int8 {
+	const (
+		mod  = 1 << (mulWindow + 1)
+		half = 1 << mulWindow
+	)
+
+	d := make([]int8, 0, 3*64+1)
+	for h != (halfScalar{}) {
+		var di int8
+		if h[0]&1 == 1 {
+			di = int8(h[0] & (mod - 1))
+			if di >= half {
+				di -= mod
+			}
+
+			// h -= dᵢ
+			if di > 0 {
+				t := h[0]
+				h[0] -= uint64(di)
+				if h[0] > t {
+					h[1]--
+					if h[1] == ^uint64(0) {
+						h[2]--
+					}
+				}
+			} else {
+				t := h[0]
+				h[0] += uint64(-di)
+				if h[0] < t {
+					h[1]++
+					if h[1] == 0 {
+						h[2]++
+					}
+				}
+			}
+		}
+		d = append(d, di)
+		h.shiftRight(1)
+	}
+	return d
+}
+
+const (
+	// msmStrausMax is the number of scalar halves up to which multiScalarMul
+	// uses Straus' method. Above it, Pippenger's method needs fewer additions.
+	msmStrausMax = 128
+)
+
+// pippengerWindow returns the window size of Pippenger's method for n
+// scalars, which roughly minimizes the (128/w)·(n + 2^w) additions.
+func pippengerWindow(n int) uint {
+	w := uint(bits.Len(uint(n)))
+	if w > 3 {
+		w -= 3
+	}
+	if w < 4 {
+		w = 4
+	}
+	if w > 16 {
+		w = 16
+	}
+	return w
+}
+
+// recodeSigned returns the digits dᵢ of h in base 2^w, least significant
+// first, with -2^(w-1) ≤ dᵢ < 2^(w-1).
+func recodeSigned(h halfScalar, w uint) []int32 {
+	const hBits = 128
+	d := make([]int32, (hBits+w-1)/w+1)
+	mask := uint64(1)<<w - 1
+	half := int32(1) << (w - 1)
+	var carry int32
+	for i := range d {
+		di := int32(h[0]&mask) + carry
+		carry = 0
+		if di >= half {
+			di -= 2 * half
+			carry = 1
+		}
+		d[i] = di
+		h.shiftRight(w)
+	}
+	return d
+}
+
+// ctEq returns all ones if a == b and zero otherwise, in constant time.
+func ctEq(a, b int) uint64 {
+	x := uint64(a ^ b)
+	return ((x | -x) >> 63) - 1
+}
+
+// ctAbsIndex returns all ones if the odd digit d is negative and zero
+// otherwise, together with the table index (|d|-1)/2.
+func ctAbsIndex(d int8) (neg uint64, idx int) {
+	neg = uint64(int64(d) >> 7)
+	idx = int((int64(d)^int64(neg))-int64(neg)) >> 1
+	return neg, idx
+}
+
+// gfpEqual returns 1 if a == b and 0 otherwise, in constant time.
+func gfpEqual(a, b *gfP) uint64 {
+	var x uint64
+	for i := range a {
+		x |= a[i] ^ b[i]
+	}
+	return ((x | -x) >> 63) ^ 1
+}
+
+// gfpCMov sets c to a if mask is all ones, and leaves it unchanged if mask is
+// zero.
+func gfpCMov(c, a *gfP, mask uint64) {
+	for i := range c {
+		c[i] ^= (c[i] ^ a[i]) & mask
+	}
+}
@@ -2,6 +2,10 @@ package bn256
 
 import (
 	"crypto/cipher"
+	"math/big"
+	"math/bits"
+	"runtime"
+	"sync"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/mod"
@@ -10,6 +14,7 @@ import (
 type groupG1 struct {
 	common
 	*commonSuite
+	compressed bool // whether the points use the compressed encoding
 }
 
 func (g *groupG1) String() string {
@@ -17,16 +22,88 @@ func (g *groupG1) String() string {
 }
 
 func (g *groupG1) PointLen() int {
-	return newPointG1().MarshalSize()
+	return g.Point().MarshalSize()
 }
 
 func (g *groupG1) Point() kyber.Point {
-	return newPointG1()
+	p := newPointG1()
+	p.compressed = g.compressed
+	return p
+}
+
+// BatchMarshal returns the encodings of all points that the points of g would
+// have, but shares a single field inversion among them to convert them to
+// affine form.
+func (g *groupG1) BatchMarshal(points []kyber.Point) ([][]byte, error) {
+	gs := make([]*curvePoint, len(points))
+	for i, p := range points {
+		c := *p.(*pointG1).g
+		gs[i] = &c
+	}
+	curveBatchMakeAffine(gs)
+
+	p := g.Point().(*pointG1)
+	size, n := p.MarshalSize(), p.ElementSize()
+	buf := make([]byte, len(points)*size)
+	ret := make([][]byte, len(points))
+	for i, c := range gs {
+		ret[i] = buf[i*size : (i+1)*size : (i+1)*size]
+		if g.compressed {
+			marshalCurveCompressed(ret[i], n, c)
+		} else {
+			marshalCurveAffine(ret[i], n, c)
+		}
+	}
+	return ret, nil
+}
+
+// HashBatch returns the points that Hash would derive from each of msgs, in
+// order. The points share one allocation, and the messages are hashed
+// concurrently on up to GOMAXPROCS goroutines.
+func (g *groupG1) HashBatch(msgs [][]byte) []kyber.Point {
+	n := len(msgs)
+	cs := make([]curvePoint, n)
+	ps := make([]pointG1, n)
+	ret := make([]kyber.Point, n)
+	for i := range ps {
+		ps[i].g, ps[i].compressed = &cs[i], g.compressed
+		ret[i] = &ps[i]
+	}
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > n {
+		workers = n
+	}
+	if workers <= 1 {
+		for i, m := range msgs {
+			hashToPoint(&cs[i], m)
+		}
+		return ret
+	}
+
+	var wg sync.WaitGroup
+	chunk := (n + workers - 1) / workers
+	for lo := 0; lo < n; lo += chunk {
+		hi := lo + chunk
+		if hi > n {
+			hi = n
+		}
+		wg.Add(1)
+		go func(lo, hi int) {
+			defer wg.Done()
+			for i := lo; i < hi; i++ {
+				hashToPoint(&cs[i], msgs[i])
+			}
+		}(lo, hi)
+	}
+	wg.Wait()
+	return ret
 }
 
 type groupG2 struct {
 	common
 	*commonSuite
+	compressed bool
 }
 
 func (g *groupG2) String() string {
@@ -34,11 +111,39 @@ func (g *groupG2) String() string {
 }
 
 func (g *groupG2) PointLen() int {
-	return newPointG2().MarshalSize()
+	return g.Point().MarshalSize()
 }
 
 func (g *groupG2) Point() kyber.Point {
-	return newPointG2()
+	p := newPointG2()
+	p.compressed = g.compressed
+	return p
+}
+
+// BatchMarshal returns the encodings of all points that the points of g would
+// have, but shares a single field inversion among them to convert them to
+// affine form.
+func (g *groupG2) BatchMarshal(points []kyber.Point) ([][]byte, error) {
+	gs := make([]*twistPoint, len(points))
+	for i, p := range points {
+		c := *toPointG2(p).g
+		gs[i] = &c
+	}
+	twistBatchMakeAffine(gs)
+
+	p := g.Point().(*pointG2)
+	size, n := p.MarshalSize(), p.ElementSize()
+	buf := make([]byte, len(points)*size)
+	ret := make([][]byte, len(points))
+	for i, c := range gs {
+		ret[i] = buf[i*size : (i+1)*size : (i+1)*size]
+		if g.compressed {
+			marshalTwistCompressed(ret[i], n, c)
+		} else {
+			marshalTwistAffine(ret[i], n, c)
+		}
+	}
+	return ret, nil
 }
 
 type groupGT struct {
@@ -58,15 +163,54 @@ func (g *groupGT) Point() kyber.Point {
 	return newPointGT()
 }
 
+// orderModulus holds the constants of the arithmetic of the scalars of G1,
+// G2 and GT, which are mod.Int256 modulo Order.
+var orderModulus = mod.NewModulus256(Order)
+
+// scalarWords returns the value of s as little-endian words below Order. The
+// points also accept a mod.Int modulo Order.
+func scalarWords(s kyber.Scalar) [4]uint64 {
+	switch s := s.(type) {
+	case *mod.Int256:
+		return s.Words()
+	case *mod.Int:
+		return orderWordsMod(&s.V)
+	}
+	panic("bn256: unsupported scalar type")
+}
+
+// scalarBig holds the value of a scalar as a big.Int backed by a fixed array,
+// so that reading a mod.Int256 takes at most one allocation. It must not be
+// copied once set.
+type scalarBig struct {
+	z   big.Int
+	buf [256 / bits.UintSize]big.Word
+}
+
+// set returns the value of s as a big.Int, which stays valid while b does.
+func (b *scalarBig) set(s kyber.Scalar) *big.Int {
+	if s, ok := s.(*mod.Int); ok {
+		return &s.V
+	}
+	w := scalarWords(s)
+	const wordsPer = 64 / bits.UintSize
+	for i := range b.buf {
+		b.buf[i] = big.Word(w[i/wordsPer] >> (uint(i%wordsPer) * bits.UintSize))
+	}
+	return b.z.SetBits(b.buf[:])
+}
+
 // common functionalities across G1, G2, and GT
 type common struct{}
 
 func (c *common) ScalarLen() int {
-	return mod.NewInt64(0, Order).MarshalSize()
+	return mod.NewInt256(0, orderModulus).MarshalSize()
 }
 
+// Scalar returns a new scalar modulo the order of the groups. It is a
+// mod.Int256, which was a mod.Int before, see package mod.
 func (c *common) Scalar() kyber.Scalar {
-	return mod.NewInt64(0, Order)
+	return mod.NewInt256(0, orderModulus)
 }
 
 func (c *common) PrimeOrder() bool {
@@ -74,5 +218,5 @@ func (c *common) PrimeOrder() bool {
 }
 
 func (c *common) NewKey(rand cipher.Stream) kyber.Scalar {
-	return mod.NewInt64(0, Order).Pick(rand)
+	return mod.NewInt256(0, orderModulus).Pick(rand)
 }
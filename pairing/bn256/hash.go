@@ -0,0 +1,215 @@
+package bn256
+
+import (
+	"crypto/sha256"
+	"time"
+
+	"go.dedis.ch/kyber/v3/util/metrics"
+)
+
+var (
+	hashCounter = metrics.NewCounter("bn256.hashToPoint")
+	// hashTriesCounter counts the iterations of the loop of hashToPoint.
+	hashTriesCounter = metrics.NewCounter("bn256.hashToPoint.Tries")
+)
+
+// hashToPoint sets c to the hash of m to a point of G₁ with
+// try-and-increment, and returns c: starting from x = SHA-256(m) mod p, it
+// increments x until x³+3 is a square. The number of tries depends on m,
+// which is fine for public messages. It allocates nothing.
+func hashToPoint(c *curvePoint, m []byte) *curvePoint {
+	if metrics.Enabled {
+		defer hashCounter.Since(time.Now())
+	}
+	h := sha256.Sum256(m)
+	var x, y, t gfP
+	x.Unmarshal(h[:])
+	// montEncode also reduces x, which is below 2^256 < 2p, mod p.
+	montEncode(&x, &x)
+
+	one := newGFp(1)
+	for {
+		if metrics.Enabled {
+			hashTriesCounter.Add(1)
+		}
+		gfpSqr(&t, &x)
+		gfpMul(&t, &t, &x)
+		gfpAdd(&t, &t, curveB)
+		if y.Sqrt(&t) {
+			c.x, c.y, c.z, c.t = x, y, *one, *one
+			return c
+		}
+		gfpAdd(&x, &x, one)
+	}
+}
+
+// The constants of the Shallue–van de Woestijne map for y² = g(x) = x³+3 with
+// Z = 1, as in section 6.6.1 of RFC 9380: svdwC1 = g(Z), svdwC2 = -Z/2,
+// svdwC3 = sqrt(-g(Z)·3Z²) with sgn0(svdwC3) = 0 and svdwC4 = -4g(Z)/(3Z²).
+var svdwC1, svdwC2, svdwC3, svdwC4 = svdwConstants()
+
+func svdwConstants() (c1, c2, c3, c4 *gfP) {
+	c1 = newGFp(4)
+
+	c2 = &gfP{}
+	c2.Invert(newGFp(-2))
+
+	c3 = &gfP{}
+	if !c3.Sqrt(newGFp(-12)) {
+		panic("bn256: -12 is not a square")
+	}
+	if gfpSgn0(c3) == 1 {
+		gfpNeg(c3, c3)
+	}
+
+	c4 = &gfP{}
+	c4.Invert(newGFp(3))
+	gfpMul(c4, c4, newGFp(-16))
+	return c1, c2, c3, c4
+}
+
+// gfpSgn0 returns the parity of the canonical integer of a.
+func gfpSgn0(a *gfP) uint64 {
+	t := &gfP{}
+	montDecode(t, a)
+	return t[0] & 1
+}
+
+// mapToCurve sets c to the image of u under the Shallue–van de Woestijne map
+// of RFC 9380, section 6.6.1, in constant time.
+func (c *curvePoint) mapToCurve(u *gfP) {
+	one := newGFp(1)
+	tv1, tv2, tv3, tv4 := &gfP{}, &gfP{}, &gfP{}, &gfP{}
+	gfpSqr(tv1, u)
+	gfpMul(tv1, tv1, svdwC1)
+	gfpAdd(tv2, one, tv1)
+	gfpSub(tv1, one, tv1)
+	gfpMul(tv3, tv1, tv2)
+	// Invert maps 0 to 0, which is the inv0 of the specification.
+	tv3.Invert(tv3)
+	gfpMul(tv4, u, tv1)
+	gfpMul(tv4, tv4, tv3)
+	gfpMul(tv4, tv4, svdwC3)
+
+	// The three candidates for x, of which x1 or x2 is used if g(x) is a
+	// square, and x3 otherwise.
+	x1, x2, x3 := &gfP{}, &gfP{}, &gfP{}
+	gfpSub(x1, svdwC2, tv4)
+	gfpAdd(x2, svdwC2, tv4)
+	gfpSqr(x3, tv2)
+	gfpMul(x3, x3, tv3)
+	gfpSqr(x3, x3)
+	gfpMul(x3, x3, svdwC4)
+	gfpAdd(x3, x3, one)
+
+	g := func(gx, x *gfP) {
+		gfpSqr(gx, x)
+		gfpMul(gx, gx, x)
+		gfpAdd(gx, gx, curveB)
+	}
+	gx, y := &gfP{}, &gfP{}
+	g(gx, x1)
+	e1 := y.sqrt(gx)
+	g(gx, x2)
+	e2 := y.sqrt(gx) &^ e1
+
+	x := x3
+	gfpCMov(x, x2, -e2)
+	gfpCMov(x, x1, -e1)
+	g(gx, x)
+	y.sqrt(gx)
+
+	// Fix the sign of y to that of u.
+	ny := &gfP{}
+	gfpNeg(ny, y)
+	gfpCMov(y, ny, -(gfpSgn0(u) ^ gfpSgn0(y)))
+
+	c.x.Set(x)
+	c.y.Set(y)
+	c.z = *newGFp(1)
+	c.t = *newGFp(1)
+}
+
+// hashToCurve hashes msg with the domain separation tag dst to G₁ as the
+// hash_to_curve function of RFC 9380 with the suite
+// BN256G1_XMD:SHA-256_SVDW_RO_: two field elements from hashToField are both
+// mapped with mapToCurve and added. This curve is not the BN254 of the RFC, so
+// there are no test vectors for it.
+func hashToCurve(msg, dst []byte) *curvePoint {
+	var u [2]gfP
+	hashToField(u[:], msg, dst)
+
+	c, q := &curvePoint{}, &curvePoint{}
+	c.mapToCurve(&u[0])
+	q.mapToCurve(&u[1])
+	c.Add(c, q)
+	return c
+}
+
+// hashToField sets u to field elements derived from msg and dst as in RFC
+// 9380, section 5.2, with expandMessageXMD and 48 bytes per element.
+func hashToField(u []gfP, msg, dst []byte) {
+	const l = 48
+	buf := expandMessageXMD(msg, dst, l*len(u))
+
+	var hi, lo [32]byte
+	for i := range u {
+		// The element is hi·2^256 + lo, with the 16 top bytes in hi.
+		b := buf[l*i : l*(i+1)]
+		copy(hi[16:], b[:16])
+		copy(lo[:], b[16:])
+
+		h, t := &gfP{}, &gfP{}
+		h.Unmarshal(hi[:])
+		t.Unmarshal(lo[:])
+		// montEncode(h)·r2 is the Montgomery form of h·2^256, and
+		// montEncode also reduces t mod p.
+		montEncode(h, h)
+		gfpMul(h, h, r2)
+		montEncode(t, t)
+		gfpAdd(&u[i], h, t)
+	}
+}
+
+// expandMessageXMD returns n bytes derived from msg and dst with
+// expand_message_xmd of RFC 9380, section 5.3.1, with SHA-256.
+func expandMessageXMD(msg, dst []byte, n int) []byte {
+	const (
+		bBytes = sha256.Size
+		sBytes = sha256.BlockSize
+	)
+	if len(dst) > 255 {
+		h := sha256.New()
+		h.Write([]byte("H2C-OVERSIZE-DST-"))
+		h.Write(dst)
+		dst = h.Sum(nil)
+	}
+	ell := (n + bBytes - 1) / bBytes
+	if ell > 255 {
+		panic("bn256: too many bytes requested from expandMessageXMD")
+	}
+	dstPrime := append(append([]byte{}, dst...), byte(len(dst)))
+
+	h := sha256.New()
+	h.Write(make([]byte, sBytes))
+	h.Write(msg)
+	h.Write([]byte{byte(n >> 8), byte(n), 0})
+	h.Write(dstPrime)
+	b0 := h.Sum(nil)
+
+	out := make([]byte, 0, ell*bBytes)
+	bi := make([]byte, bBytes)
+	for i := 1; i <= ell; i++ {
+		// b_1 = H(b_0 || 1 || dst') and b_i = H((b_0 ⊕ b_(i-1)) || i || dst')
+		for j := range bi {
+			bi[j] ^= b0[j]
+		}
+		h.Reset()
+		h.Write(bi)
+		h.Write([]byte{byte(i)})
+		h.Write(dstPrime)
+		bi = h.Sum(bi[:0])
+		out = append(out, bi...)
+	}
+	return out[:n]
+}
@@ -0,0 +1,38 @@
+// +build metrics
+
+package bn256
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/metrics"
+)
+
+func TestMetrics(t *testing.T) {
+	suite := NewSuite()
+	p1 := suite.G1().Point().Base()
+	p2 := suite.G2().Point().Base()
+
+	metrics.Reset()
+	suite.Pair(p1, p2)
+	suite.PairingCheck([]kyber.Point{p1, p1}, []kyber.Point{p2, p2})
+	suite.G1().Point().Mul(suite.G1().Scalar().SetInt64(3), p1)
+	hashToPoint(new(curvePoint), []byte("metrics"))
+
+	s := metrics.Snapshot()
+	for name, count := range map[string]uint64{
+		"bn256.Pair":         1,
+		"bn256.PairingCheck": 1,
+		"bn256.Miller":       2,
+		"bn256.Miller.Pairs": 3,
+		"bn256.Finalize":     2,
+		"bn256.G1.Mul":       1,
+		"bn256.hashToPoint":  1,
+	} {
+		require.Equal(t, count, s[name].Count, name)
+	}
+	require.True(t, s["bn256.Pair"].Nanos > 0)
+	require.True(t, s["bn256.hashToPoint.Tries"].Count > 0)
+}
@@ -0,0 +1,59 @@
+#define mulADXRow(bi, ra, t0,t1,t2,t3,t4,t5) \
+	\ // t += bi * a, using CF for the low and OF for the high words
+	MOVQ bi, DX \
+	XORQ CX, CX \
+	MULXQ 0+ra, AX, BX \
+	ADCXQ AX, t0 \
+	ADOXQ BX, t1 \
+	MULXQ 8+ra, AX, BX \
+	ADCXQ AX, t1 \
+	ADOXQ BX, t2 \
+	MULXQ 16+ra, AX, BX \
+	ADCXQ AX, t2 \
+	ADOXQ BX, t3 \
+	MULXQ 24+ra, AX, BX \
+	ADCXQ AX, t3 \
+	ADOXQ BX, t4 \
+	ADCXQ CX, t4 \
+	ADOXQ CX, t5 \
+	ADCXQ CX, t5 \
+	\
+	\ // m = (t0 * N') mod 2^64, t += m * p which clears t0
+	MOVQ ·np+0(SB), DX \
+	IMULQ t0, DX \
+	XORQ CX, CX \
+	MULXQ ·p2+0(SB), AX, BX \
+	ADCXQ AX, t0 \
+	ADOXQ BX, t1 \
+	MULXQ ·p2+8(SB), AX, BX \
+	ADCXQ AX, t1 \
+	ADOXQ BX, t2 \
+	MULXQ ·p2+16(SB), AX, BX \
+	ADCXQ AX, t2 \
+	ADOXQ BX, t3 \
+	MULXQ ·p2+24(SB), AX, BX \
+	ADCXQ AX, t3 \
+	ADOXQ BX, t4 \
+	ADCXQ CX, t4 \
+	ADOXQ CX, t5 \
+	ADCXQ CX, t5
+
+// mulADX computes the Montgomery product a*b*R^-1 with the CIOS method,
+// interleaving every row of the multiplication with one word of the
+// reduction. After each row the lowest word is zero and is reused as the new
+// top word, so the registers rotate instead of being shifted. The result is
+// stored in R12:R13:R8:R9 and reduced mod p.
+#define mulADX(ra, rb) \
+	XORQ R8, R8 \
+	XORQ R9, R9 \
+	XORQ R10, R10 \
+	XORQ R11, R11 \
+	XORQ R12, R12 \
+	XORQ R13, R13 \
+	\
+	mulADXRow( 0+rb, ra, R8,R9,R10,R11,R12,R13) \
+	mulADXRow( 8+rb, ra, R9,R10,R11,R12,R13,R8) \
+	mulADXRow(16+rb, ra, R10,R11,R12,R13,R8,R9) \
+	mulADXRow(24+rb, ra, R11,R12,R13,R8,R9,R10) \
+	\
+	gfpCarry(R12,R13,R8,R9,R10, R14,R15,AX,BX,CX)
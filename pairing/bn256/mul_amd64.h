@@ -106,6 +106,81 @@
 	storeBlock(R8,R9,R10,R11, 24+stack) \
 	MOVQ R12, 56+stack
 
+#define sqr(a0,a1,a2,a3, stack) \
+	\ // Squares aᵢ² on the diagonal, stored in the output block
+	MOVQ a0, AX \
+	MULQ AX \
+	MOVQ AX, 0+stack \
+	MOVQ DX, 8+stack \
+	MOVQ a1, AX \
+	MULQ AX \
+	MOVQ AX, 16+stack \
+	MOVQ DX, 24+stack \
+	MOVQ a2, AX \
+	MULQ AX \
+	MOVQ AX, 32+stack \
+	MOVQ DX, 40+stack \
+	MOVQ a3, AX \
+	MULQ AX \
+	MOVQ AX, 48+stack \
+	MOVQ DX, 56+stack \
+	\
+	\ // Cross products aᵢaⱼ with i<j, stored in R9:...:R14
+	MOVQ a0, AX \
+	MULQ a1 \
+	MOVQ AX, R9 \
+	MOVQ DX, R10 \
+	MOVQ a0, AX \
+	MULQ a2 \
+	ADDQ AX, R10 \
+	ADCQ $0, DX \
+	MOVQ DX, R11 \
+	MOVQ a0, AX \
+	MULQ a3 \
+	ADDQ AX, R11 \
+	ADCQ $0, DX \
+	MOVQ DX, R12 \
+	\
+	MOVQ a1, AX \
+	MULQ a2 \
+	MOVQ AX, BX \
+	MOVQ DX, CX \
+	MOVQ a1, AX \
+	MULQ a3 \
+	ADDQ AX, CX \
+	ADCQ $0, DX \
+	MOVQ DX, R13 \
+	ADDQ BX, R11 \
+	ADCQ CX, R12 \
+	ADCQ $0, R13 \
+	\
+	MOVQ a2, AX \
+	MULQ a3 \
+	ADDQ AX, R13 \
+	ADCQ $0, DX \
+	MOVQ DX, R14 \
+	\
+	\ // Double the cross products and add the diagonal
+	MOVQ $0, R15 \
+	ADDQ R9, R9 \
+	ADCQ R10, R10 \
+	ADCQ R11, R11 \
+	ADCQ R12, R12 \
+	ADCQ R13, R13 \
+	ADCQ R14, R14 \
+	ADCQ $0, R15 \
+	\
+	MOVQ 0+stack, R8 \
+	ADDQ 8+stack, R9 \
+	ADCQ 16+stack, R10 \
+	ADCQ 24+stack, R11 \
+	ADCQ 32+stack, R12 \
+	ADCQ 40+stack, R13 \
+	ADCQ 48+stack, R14 \
+	ADCQ 56+stack, R15 \
+	storeBlock(R8,R9,R10,R11, 0+stack) \
+	storeBlock(R12,R13,R14,R15, 32+stack)
+
 #define gfpReduce(stack) \
 	\ // m = (T * N') mod R, store m in R8:R9:R10:R11
 	MOVQ ·np+0(SB), AX \
@@ -60,12 +60,65 @@
 	ADCS R0, R29 \
 	UMULH R4, R8, c7 \
 	ADCS ZR, c7 \
-	ADDS R25, c3 \
+	ADDS R1, c3 \
 	ADCS R26, c4 \
 	ADCS R27, c5 \
 	ADCS R29, c6 \
 	ADCS  ZR, c7
 
+#define sqr(c0,c1,c2,c3,c4,c5,c6,c7) \
+	\ // Cross products aᵢaⱼ with i<j, stored in c1:...:c6
+	MUL R1, R2, c1 \
+	UMULH R1, R2, c2 \
+	MUL R1, R3, R0 \
+	ADDS R0, c2 \
+	UMULH R1, R3, c3 \
+	MUL R1, R4, R0 \
+	ADCS R0, c3 \
+	UMULH R1, R4, c4 \
+	ADCS ZR, c4 \
+	\
+	MUL R2, R3, R5 \
+	UMULH R2, R3, R6 \
+	MUL R2, R4, R0 \
+	ADDS R0, R6 \
+	UMULH R2, R4, c5 \
+	ADCS ZR, c5 \
+	ADDS R5, c3 \
+	ADCS R6, c4 \
+	ADCS ZR, c5 \
+	\
+	MUL R3, R4, R0 \
+	ADDS R0, c5 \
+	UMULH R3, R4, c6 \
+	ADCS ZR, c6 \
+	\
+	\ // Double the cross products
+	ADDS c1, c1 \
+	ADCS c2, c2 \
+	ADCS c3, c3 \
+	ADCS c4, c4 \
+	ADCS c5, c5 \
+	ADCS c6, c6 \
+	ADC ZR, ZR, c7 \
+	\
+	\ // Add the squares aᵢ² on the diagonal
+	MUL R1, R1, c0 \
+	UMULH R1, R1, R0 \
+	ADDS R0, c1 \
+	MUL R2, R2, R5 \
+	UMULH R2, R2, R6 \
+	ADCS R5, c2 \
+	ADCS R6, c3 \
+	MUL R3, R3, R5 \
+	UMULH R3, R3, R6 \
+	ADCS R5, c4 \
+	ADCS R6, c5 \
+	MUL R4, R4, R5 \
+	UMULH R4, R4, R6 \
+	ADCS R5, c6 \
+	ADC R6, c7
+
 #define gfpReduce() \
 	\ // m = (T * N') mod R, store m in R1:R2:R3:R4
 	MOVD ·np+0(SB), R17 \
@@ -126,6 +179,7 @@
 	SBCS R6, R22, R11 \
 	SBCS R7, R23, R12 \
 	SBCS R8, R24, R13 \
+	SBCS ZR, R0, R0 \
 	\
 	CSEL CS, R10, R21, R1 \
 	CSEL CS, R11, R22, R2 \
@@ -60,6 +60,57 @@
 	ADCQ AX, R14 \
 	ADCQ BX, R15
 
+#define sqrBMI2(a0,a1,a2,a3) \
+	\ // Cross products aᵢaⱼ with i<j, stored in R9:...:R14
+	MOVQ a0, DX \
+	MULXQ a1, R9, R10 \
+	MULXQ a2, AX, R11 \
+	ADDQ AX, R10 \
+	MULXQ a3, AX, R12 \
+	ADCQ AX, R11 \
+	ADCQ $0, R12 \
+	\
+	MOVQ a1, DX \
+	MULXQ a2, AX, BX \
+	MULXQ a3, CX, R13 \
+	ADDQ CX, BX \
+	ADCQ $0, R13 \
+	ADDQ AX, R11 \
+	ADCQ BX, R12 \
+	ADCQ $0, R13 \
+	\
+	MOVQ a2, DX \
+	MULXQ a3, AX, R14 \
+	ADDQ AX, R13 \
+	ADCQ $0, R14 \
+	\
+	\ // Double the cross products
+	MOVQ $0, R15 \
+	ADDQ R9, R9 \
+	ADCQ R10, R10 \
+	ADCQ R11, R11 \
+	ADCQ R12, R12 \
+	ADCQ R13, R13 \
+	ADCQ R14, R14 \
+	ADCQ $0, R15 \
+	\
+	\ // Add the squares aᵢ² on the diagonal
+	MOVQ a0, DX \
+	MULXQ DX, R8, AX \
+	ADDQ AX, R9 \
+	MOVQ a1, DX \
+	MULXQ DX, AX, BX \
+	ADCQ AX, R10 \
+	ADCQ BX, R11 \
+	MOVQ a2, DX \
+	MULXQ DX, AX, BX \
+	ADCQ AX, R12 \
+	ADCQ BX, R13 \
+	MOVQ a3, DX \
+	MULXQ DX, AX, BX \
+	ADCQ AX, R14 \
+	ADCQ BX, R15
+
 #define gfpReduceBMI2() \
 	\ // m = (T * N') mod R, store m in R8:R9:R10:R11
 	MOVQ ·np+0(SB), DX \
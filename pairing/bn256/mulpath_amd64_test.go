@@ -0,0 +1,30 @@
+// +build amd64,!generic
+
+package bn256
+
+import "testing"
+
+// setMulPath selects the field multiplication named by -bn256.mul, and
+// returns a function that restores the one detected at startup. It skips the
+// benchmark if the CPU lacks the instructions of that multiplication.
+func setMulPath(b *testing.B) func() {
+	oldBMI2, oldADX := hasBMI2, hasADX
+	switch *benchMul {
+	case "":
+	case "mul":
+		hasBMI2, hasADX = false, false
+	case "bmi2":
+		if !oldBMI2 {
+			b.Skip("the CPU does not support BMI2")
+		}
+		hasBMI2, hasADX = true, false
+	case "adx":
+		if !oldADX {
+			b.Skip("the CPU does not support ADX")
+		}
+		hasBMI2, hasADX = true, true
+	default:
+		b.Fatalf("unknown -bn256.mul %q", *benchMul)
+	}
+	return func() { hasBMI2, hasADX = oldBMI2, oldADX }
+}
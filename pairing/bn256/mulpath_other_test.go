@@ -0,0 +1,13 @@
+// +build !amd64 generic
+
+package bn256
+
+import "testing"
+
+// setMulPath only has a choice of multiplications with the amd64 assembly.
+func setMulPath(b *testing.B) func() {
+	if *benchMul != "" {
+		b.Skip("-bn256.mul needs the amd64 assembly")
+	}
+	return func() {}
+}
@@ -1,6 +1,23 @@
 package bn256
 
-func lineFunctionAdd(r, p *twistPoint, q *curvePoint, r2 *gfP2) (a, b, c *gfP2, rOut *twistPoint) {
+import (
+	"time"
+
+	"go.dedis.ch/kyber/v3/util/metrics"
+)
+
+var finalizeCounter = metrics.NewCounter("bn256.Finalize")
+
+// lineCoeffs are the coefficients of a line function of the Miller loop. They
+// only depend on the G2 point: the line is evaluated at a G1 point q by
+// multiplying b with q.x and c with q.y.
+type lineCoeffs struct {
+	a, b, c gfP2
+}
+
+// lineFunctionAdd sets l to the line through r and the affine p, and rOut to
+// r+p. rOut must not alias r.
+func lineFunctionAdd(l *lineCoeffs, rOut, r, p *twistPoint, r2 *gfP2) {
 	// See the mixed addition algorithm from "Faster Computation of the
 	// Tate Pairing", http://arxiv.org/pdf/0904.0854v3.pdf
 	B := (&gfP2{}).Mul(&p.x, &r.t)
@@ -21,7 +38,6 @@ func lineFunctionAdd(r, p *twistPoint, q *curvePoint, r2 *gfP2) (a, b, c *gfP2,
 
 	V := (&gfP2{}).Mul(&r.x, E)
 
-	rOut = &twistPoint{}
 	rOut.x.Square(L1).Sub(&rOut.x, J).Sub(&rOut.x, V).Sub(&rOut.x, V)
 
 	rOut.z.Add(&r.z, H).Square(&rOut.z).Sub(&rOut.z, &r.t).Sub(&rOut.z, I)
@@ -38,18 +54,17 @@ func lineFunctionAdd(r, p *twistPoint, q *curvePoint, r2 *gfP2) (a, b, c *gfP2,
 
 	t2.Mul(L1, &p.x)
 	t2.Add(t2, t2)
-	a = (&gfP2{}).Sub(t2, t)
+	l.a.Sub(t2, t)
 
-	c = (&gfP2{}).MulScalar(&rOut.z, &q.y)
-	c.Add(c, c)
+	l.c.Add(&rOut.z, &rOut.z)
 
-	b = (&gfP2{}).Neg(L1)
-	b.MulScalar(b, &q.x).Add(b, b)
-
-	return
+	l.b.Neg(L1)
+	l.b.Add(&l.b, &l.b)
 }
 
-func lineFunctionDouble(r *twistPoint, q *curvePoint) (a, b, c *gfP2, rOut *twistPoint) {
+// lineFunctionDouble sets l to the tangent at r, and rOut to 2r. rOut must not
+// alias r.
+func lineFunctionDouble(l *lineCoeffs, rOut, r *twistPoint) {
 	// See the doubling algorithm for a=0 from "Faster Computation of the
 	// Tate Pairing", http://arxiv.org/pdf/0904.0854v3.pdf
 	A := (&gfP2{}).Square(&r.x)
@@ -64,7 +79,6 @@ func lineFunctionDouble(r *twistPoint, q *curvePoint) (a, b, c *gfP2, rOut *twis
 
 	G := (&gfP2{}).Square(E)
 
-	rOut = &twistPoint{}
 	rOut.x.Sub(G, D).Sub(&rOut.x, D)
 
 	rOut.z.Add(&r.y, &r.z).Square(&rOut.z).Sub(&rOut.z, B).Sub(&rOut.z, &r.t)
@@ -77,26 +91,25 @@ func lineFunctionDouble(r *twistPoint, q *curvePoint) (a, b, c *gfP2, rOut *twis
 	rOut.t.Square(&rOut.z)
 
 	t.Mul(E, &r.t).Add(t, t)
-	b = (&gfP2{}).Neg(t)
-	b.MulScalar(b, &q.x)
+	l.b.Neg(t)
 
-	a = (&gfP2{}).Add(&r.x, E)
+	a := &l.a
+	a.Add(&r.x, E)
 	a.Square(a).Sub(a, A).Sub(a, G)
 	t.Add(B, B).Add(t, t)
 	a.Sub(a, t)
 
-	c = (&gfP2{}).Mul(&rOut.z, &r.t)
-	c.Add(c, c).MulScalar(c, &q.y)
-
-	return
+	l.c.Mul(&rOut.z, &r.t)
+	l.c.Add(&l.c, &l.c)
 }
 
 func mulLine(ret *gfP12, a, b, c *gfP2) {
+	// The products are accumulated unreduced, see gfPWide.
 	a2 := &gfP6{}
 	a2.y.Set(a)
 	a2.z.Set(b)
-	a2.Mul(a2, &ret.x)
-	t3 := (&gfP6{}).MulScalar(&ret.y, c)
+	a2w := (&gfP6Wide{}).Mul(a2, &ret.x)
+	t3 := (&gfP6Wide{}).MulScalar(&ret.y, c)
 
 	t := (&gfP2{}).Add(b, c)
 	t2 := &gfP6{}
@@ -104,57 +117,71 @@ func mulLine(ret *gfP12, a, b, c *gfP2) {
 	t2.z.Set(t)
 	ret.x.Add(&ret.x, &ret.y)
 
-	ret.y.Set(t3)
+	tx := (&gfP6Wide{}).Mul(&ret.x, t2)
+	tx.Sub(tx, a2w).Sub(tx, t3)
+	ret.x.Reduce(tx)
 
-	ret.x.Mul(&ret.x, t2).Sub(&ret.x, a2).Sub(&ret.x, &ret.y)
-	a2.MulTau(a2)
-	ret.y.Add(&ret.y, a2)
+	a2w.MulTau(a2w)
+	t3.Add(t3, a2w)
+	ret.y.Reduce(t3)
 }
 
 // sixuPlus2NAF is 6u+2 in non-adjacent form.
 var sixuPlus2NAF = []int8{0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1}
 
-// miller implements the Miller loop for calculating the Optimal Ate pairing.
-// See algorithm 1 from http://cryptojedi.org/papers/dclxvi-20100714.pdf
-func miller(q *twistPoint, p *curvePoint) *gfP12 {
-	ret := (&gfP12{}).SetOne()
+// numLines is the number of line functions evaluated by the Miller loop.
+var numLines = func() int {
+	n := len(sixuPlus2NAF) - 1 + 2
+	for _, d := range sixuPlus2NAF[:len(sixuPlus2NAF)-1] {
+		if d != 0 {
+			n++
+		}
+	}
+	return n
+}()
+
+// prepareLines computes the coefficients of all the line functions of the
+// Miller loop for q, in the order in which multiMiller evaluates them. The
+// twist point arithmetic of the loop is done here.
+func prepareLines(q *twistPoint) []lineCoeffs {
+	return appendLines(make([]lineCoeffs, 0, numLines), q)
+}
+
+// appendLines appends the line functions of prepareLines for q to lines,
+// which does not allocate if lines has room for numLines more of them.
+func appendLines(lines []lineCoeffs, q *twistPoint) []lineCoeffs {
+	next := func() *lineCoeffs {
+		lines = append(lines, lineCoeffs{})
+		return &lines[len(lines)-1]
+	}
 
 	aAffine := &twistPoint{}
 	aAffine.Set(q)
 	aAffine.MakeAffine()
 
-	bAffine := &curvePoint{}
-	bAffine.Set(p)
-	bAffine.MakeAffine()
-
 	minusA := &twistPoint{}
 	minusA.Neg(aAffine)
 
-	r := &twistPoint{}
+	// The line functions alternate between r and newR, since they cannot
+	// update r in place.
+	r, newR := &twistPoint{}, &twistPoint{}
 	r.Set(aAffine)
 
 	r2 := (&gfP2{}).Square(&aAffine.y)
 
 	for i := len(sixuPlus2NAF) - 1; i > 0; i-- {
-		a, b, c, newR := lineFunctionDouble(r, bAffine)
-		if i != len(sixuPlus2NAF)-1 {
-			ret.Square(ret)
-		}
-
-		mulLine(ret, a, b, c)
-		r = newR
+		lineFunctionDouble(next(), newR, r)
+		r, newR = newR, r
 
 		switch sixuPlus2NAF[i-1] {
 		case 1:
-			a, b, c, newR = lineFunctionAdd(r, aAffine, bAffine, r2)
+			lineFunctionAdd(next(), newR, r, aAffine, r2)
 		case -1:
-			a, b, c, newR = lineFunctionAdd(r, minusA, bAffine, r2)
+			lineFunctionAdd(next(), newR, r, minusA, r2)
 		default:
 			continue
 		}
-
-		mulLine(ret, a, b, c)
-		r = newR
+		r, newR = newR, r
 	}
 
 	// In order to calculate Q1 we have to convert q from the sextic twist
@@ -191,22 +218,62 @@ func miller(q *twistPoint, p *curvePoint) *gfP12 {
 	minusQ2.t.SetOne()
 
 	r2.Square(&q1.y)
-	a, b, c, newR := lineFunctionAdd(r, q1, bAffine, r2)
-	mulLine(ret, a, b, c)
-	r = newR
+	lineFunctionAdd(next(), newR, r, q1, r2)
+	r, newR = newR, r
 
 	r2.Square(&minusQ2.y)
-	a, b, c, newR = lineFunctionAdd(r, minusQ2, bAffine, r2)
-	mulLine(ret, a, b, c)
-	r = newR
+	lineFunctionAdd(next(), newR, r, minusQ2, r2)
+
+	return lines
+}
+
+// multiMiller sets ret to the product of the Miller loops of the pairs of G2
+// points, given by their prepared lines, and affine G1 points ps, and returns
+// ret. See algorithm 1 from http://cryptojedi.org/papers/dclxvi-20100714.pdf
+// for a single loop. The loops run in lockstep and accumulate into the same
+// gfP12, so the squarings of the accumulator are shared between all pairs.
+func multiMiller(ret *gfP12, lines [][]lineCoeffs, ps []curvePoint) *gfP12 {
+	ret.SetOne()
+
+	b, c := &gfP2{}, &gfP2{}
+	mulLines := func(k int) {
+		for j := range lines {
+			l := &lines[j][k]
+			b.MulScalar(&l.b, &ps[j].x)
+			c.MulScalar(&l.c, &ps[j].y)
+			mulLine(ret, &l.a, b, c)
+		}
+	}
+
+	k := 0
+	for i := len(sixuPlus2NAF) - 1; i > 0; i-- {
+		if i != len(sixuPlus2NAF)-1 {
+			ret.Square(ret)
+		}
+
+		mulLines(k)
+		k++
+
+		if sixuPlus2NAF[i-1] != 0 {
+			mulLines(k)
+			k++
+		}
+	}
+
+	// The lines through Q1 and -Q2.
+	mulLines(k)
+	mulLines(k + 1)
 
 	return ret
 }
 
-// finalExponentiation computes the (p¹²-1)/Order-th power of an element of
-// GF(p¹²) to obtain an element of GT (steps 13-15 of algorithm 1 from
-// http://cryptojedi.org/papers/dclxvi-20100714.pdf)
-func finalExponentiation(in *gfP12) *gfP12 {
+// finalExponentiation sets e to the (p¹²-1)/Order-th power of in, an element
+// of GF(p¹²), to obtain an element of GT, and returns e (steps 13-15 of
+// algorithm 1 from http://cryptojedi.org/papers/dclxvi-20100714.pdf)
+func finalExponentiation(e, in *gfP12) *gfP12 {
+	if metrics.Enabled {
+		defer finalizeCounter.Since(time.Now())
+	}
 	t1 := &gfP12{}
 
 	// This is the p^6-Frobenius
@@ -224,9 +291,11 @@ func finalExponentiation(in *gfP12) *gfP12 {
 	fp2 := (&gfP12{}).FrobeniusP2(t1)
 	fp3 := (&gfP12{}).Frobenius(fp2)
 
-	fu := (&gfP12{}).Exp(t1, u)
-	fu2 := (&gfP12{}).Exp(fu, u)
-	fu3 := (&gfP12{}).Exp(fu2, u)
+	// t1 is now in the cyclotomic subgroup, which allows for the cheaper
+	// cyclotomic squarings below.
+	fu := (&gfP12{}).CyclotomicExp(t1, u)
+	fu2 := (&gfP12{}).CyclotomicExp(fu, u)
+	fu3 := (&gfP12{}).CyclotomicExp(fu2, u)
 
 	y3 := (&gfP12{}).Frobenius(fu)
 	fu2p := (&gfP12{}).Frobenius(fu2)
@@ -245,24 +314,14 @@ func finalExponentiation(in *gfP12) *gfP12 {
 	y6 := (&gfP12{}).Mul(fu3, fu3p)
 	y6.Conjugate(y6)
 
-	t0 := (&gfP12{}).Square(y6)
+	t0 := (&gfP12{}).CyclotomicSquare(y6)
 	t0.Mul(t0, y4).Mul(t0, y5)
 	t1.Mul(y3, y5).Mul(t1, t0)
 	t0.Mul(t0, y2)
-	t1.Square(t1).Mul(t1, t0).Square(t1)
+	t1.CyclotomicSquare(t1).Mul(t1, t0).CyclotomicSquare(t1)
 	t0.Mul(t1, y1)
 	t1.Mul(t1, y0)
-	t0.Square(t0).Mul(t0, t1)
+	t0.CyclotomicSquare(t0).Mul(t0, t1)
 
-	return t0
-}
-
-func optimalAte(a *twistPoint, b *curvePoint) *gfP12 {
-	e := miller(a, b)
-	ret := finalExponentiation(e)
-
-	if a.IsInfinity() || b.IsInfinity() {
-		ret.SetOne()
-	}
-	return ret
+	return e.Set(t0)
 }
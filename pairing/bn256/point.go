@@ -2,20 +2,33 @@ package bn256
 
 import (
 	"crypto/cipher"
-	"crypto/sha256"
 	"crypto/subtle"
 	"errors"
 	"io"
 	"math/big"
+	"sync"
+	"time"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/mod"
+	"go.dedis.ch/kyber/v3/util/metrics"
 )
 
 var marshalPointID = [8]byte{'b', 'n', '2', '5', '6', '.', 'g', '2'}
 
+// The type tags of the compressed encodings of G1 and G2, and of the
+// uncompressed one of G1.
+var (
+	marshalPointG1ID           = [8]byte{'b', 'n', '2', '5', '6', '.', 'g', '1'}
+	marshalCompressedPointG1ID = [8]byte{'b', 'n', '2', '5', '6', '.', 'c', '1'}
+	marshalCompressedPointG2ID = [8]byte{'b', 'n', '2', '5', '6', '.', 'c', '2'}
+)
+
 type pointG1 struct {
-	g *curvePoint
+	g       *curvePoint
+	varTime bool
+	// compressed selects the compressed encoding, see compress.go.
+	compressed bool
 }
 
 func newPointG1() *pointG1 {
@@ -24,9 +37,11 @@ func newPointG1() *pointG1 {
 }
 
 func (p *pointG1) Equal(q kyber.Point) bool {
-	x, _ := p.MarshalBinary()
-	y, _ := q.MarshalBinary()
-	return subtle.ConstantTimeCompare(x, y) == 1
+	pq, ok := q.(*pointG1)
+	if !ok {
+		return false
+	}
+	return p.g.Equal(pq.g)
 }
 
 func (p *pointG1) Null() kyber.Point {
@@ -40,9 +55,8 @@ func (p *pointG1) Base() kyber.Point {
 }
 
 func (p *pointG1) Pick(rand cipher.Stream) kyber.Point {
-	s := mod.NewInt64(0, Order).Pick(rand)
-	p.Base()
-	p.g.Mul(p.g, &s.(*mod.Int).V)
+	s := mod.NewInt256(0, orderModulus).Pick(rand)
+	p.g.mulBase(scalarWords(s))
 	return p
 }
 
@@ -56,6 +70,7 @@ func (p *pointG1) Set(q kyber.Point) kyber.Point {
 func (p *pointG1) Clone() kyber.Point {
 	q := newPointG1()
 	q.g = p.g.Clone()
+	q.compressed = p.compressed
 	return q
 }
 
@@ -95,37 +110,125 @@ func (p *pointG1) Neg(q kyber.Point) kyber.Point {
 	return p
 }
 
+var (
+	g1MulCounter            = metrics.NewCounter("bn256.G1.Mul")
+	g1MultiScalarMulCounter = metrics.NewCounter("bn256.G1.MultiScalarMul")
+	g2MulCounter            = metrics.NewCounter("bn256.G2.Mul")
+	g2MultiScalarMulCounter = metrics.NewCounter("bn256.G2.MultiScalarMul")
+	gtMulCounter            = metrics.NewCounter("bn256.GT.Mul")
+)
+
 func (p *pointG1) Mul(s kyber.Scalar, q kyber.Point) kyber.Point {
+	if metrics.Enabled {
+		defer g1MulCounter.Since(time.Now())
+	}
 	if q == nil {
-		q = newPointG1().Base()
+		p.g.mulBase(scalarWords(s))
+		return p
 	}
-	t := s.(*mod.Int).V
 	r := q.(*pointG1).g
-	p.g.Mul(r, &t)
+	if *r == *curveGen {
+		p.g.mulBase(scalarWords(s))
+		return p
+	}
+	var k scalarBig
+	t := k.set(s)
+	if p.varTime {
+		p.g.mulVartime(r, t)
+	} else {
+		p.g.Mul(r, t)
+	}
 	return p
 }
 
+// MultiScalarMul sets p to the sum of scalars[i]·points[i] and returns it. A
+// nil point stands for the base point. It runs in variable time, so only use
+// it on public scalars and points.
+func (p *pointG1) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("bn256.G1: mismatched number of scalars and points")
+	}
+	if metrics.Enabled {
+		defer g1MultiScalarMulCounter.Since(time.Now())
+	}
+	bs := make([]scalarBig, len(scalars))
+	ks := make([]*big.Int, len(scalars))
+	gs := make([]*curvePoint, len(points))
+	for i, q := range points {
+		ks[i] = bs[i].set(scalars[i])
+		if q == nil {
+			gs[i] = curveGen
+		} else {
+			gs[i] = q.(*pointG1).g
+		}
+	}
+	p.g.multiScalarMul(ks, gs)
+	return p
+}
+
+// AllowVarTime sets a flag in this object which determines if a faster
+// but variable time implementation can be used. Set this only on Points
+// which represent public information. Using variable time algorithms to
+// operate on private information can result in timing side-channels.
+func (p *pointG1) AllowVarTime(varTime bool) {
+	p.varTime = varTime
+}
+
 func (p *pointG1) MarshalBinary() ([]byte, error) {
-	// Clone is required as we change the point
-	p = p.Clone().(*pointG1)
+	return p.AppendBinary(make([]byte, 0, p.MarshalSize()))
+}
 
+// AppendBinary appends the MarshalBinary encoding of p to b and returns the
+// extended buffer. It does not allocate if b has enough spare capacity.
+func (p *pointG1) AppendBinary(b []byte) ([]byte, error) {
 	n := p.ElementSize()
-	// Take a copy so that p is not written to, so calls to MarshalBinary
+	// Take a copy so that p is not written to, so calls to AppendBinary
 	// are threadsafe.
 	pgtemp := *p.g
 	pgtemp.MakeAffine()
-	ret := make([]byte, p.MarshalSize())
-	if pgtemp.IsInfinity() {
-		return ret, nil
+	ret, out := sliceForAppend(b, p.MarshalSize())
+	if p.compressed {
+		marshalCurveCompressed(out, n, &pgtemp)
+	} else {
+		marshalCurveAffine(out, n, &pgtemp)
 	}
-	tmp := &gfP{}
-	montDecode(tmp, &pgtemp.x)
-	tmp.Marshal(ret)
-	montDecode(tmp, &pgtemp.y)
-	tmp.Marshal(ret[n:])
 	return ret, nil
 }
 
+// sliceForAppend extends in by n bytes, reallocating it if its capacity is
+// too small, and returns the extended slice and its last n bytes.
+func sliceForAppend(in []byte, n int) (head, tail []byte) {
+	if total := len(in) + n; cap(in) >= total {
+		head = in[:total]
+	} else {
+		head = make([]byte, total)
+		copy(head, in)
+	}
+	tail = head[len(in):]
+	return head, tail
+}
+
+// zeroBytes sets all bytes of b to zero.
+func zeroBytes(b []byte) {
+	for i := range b {
+		b[i] = 0
+	}
+}
+
+// marshalCurveAffine writes the affine c to out, with n bytes per
+// coordinate. The point at infinity is all zeros.
+func marshalCurveAffine(out []byte, n int, c *curvePoint) {
+	if c.IsInfinity() {
+		zeroBytes(out[:2*n])
+		return
+	}
+	tmp := &gfP{}
+	montDecode(tmp, &c.x)
+	tmp.Marshal(out)
+	montDecode(tmp, &c.y)
+	tmp.Marshal(out[n:])
+}
+
 func (p *pointG1) MarshalTo(w io.Writer) (int, error) {
 	buf, err := p.MarshalBinary()
 	if err != nil {
@@ -141,8 +244,9 @@ func (p *pointG1) UnmarshalBinary(buf []byte) error {
 	}
 	if p.g == nil {
 		p.g = &curvePoint{}
-	} else {
-		p.g.x, p.g.y = gfP{0}, gfP{0}
+	}
+	if p.compressed {
+		return unmarshalCurveCompressed(p.g, n, buf)
 	}
 
 	p.g.x.Unmarshal(buf)
@@ -178,9 +282,21 @@ func (p *pointG1) UnmarshalFrom(r io.Reader) (int, error) {
 }
 
 func (p *pointG1) MarshalSize() int {
+	if p.compressed {
+		return 1 + p.ElementSize()
+	}
 	return 2 * p.ElementSize()
 }
 
+// MarshalID returns the type tag used in encoding/decoding, which depends on
+// whether the point is compressed.
+func (p *pointG1) MarshalID() [8]byte {
+	if p.compressed {
+		return marshalCompressedPointG1ID
+	}
+	return marshalPointG1ID
+}
+
 func (p *pointG1) ElementSize() int {
 	return 256 / 8
 }
@@ -189,66 +305,34 @@ func (p *pointG1) String() string {
 	return "bn256.G1:" + p.g.String()
 }
 
+// Hash sets p to a point derived from m with try-and-increment, and returns
+// p. Its time depends on m, so only use it on public messages; see
+// HashToCurve for a constant-time alternative.
 func (p *pointG1) Hash(m []byte) kyber.Point {
-	leftPad32 := func(in []byte) []byte {
-		if len(in) > 32 {
-			panic("input cannot be more than 32 bytes")
-		}
-
-		out := make([]byte, 32)
-		copy(out[32-len(in):], in)
-		return out
-	}
-
-	bigX, bigY := hashToPoint(m)
 	if p.g == nil {
 		p.g = new(curvePoint)
 	}
-
-	x, y := new(gfP), new(gfP)
-	x.Unmarshal(leftPad32(bigX.Bytes()))
-	y.Unmarshal(leftPad32(bigY.Bytes()))
-	montEncode(x, x)
-	montEncode(y, y)
-
-	p.g.Set(&curvePoint{*x, *y, *newGFp(1), *newGFp(1)})
+	hashToPoint(p.g, m)
 	return p
 }
 
-// hashes a byte slice into two points on a curve represented by big.Int
-// ideally we want to do this using gfP, but gfP doesn't have a ModSqrt function
-func hashToPoint(m []byte) (*big.Int, *big.Int) {
-	// we need to convert curveB into a bigInt for our computation
-	intCurveB := new(big.Int)
-	{
-		decodedCurveB := new(gfP)
-		montDecode(decodedCurveB, curveB)
-		bufCurveB := make([]byte, 32)
-		decodedCurveB.Marshal(bufCurveB)
-		intCurveB.SetBytes(bufCurveB)
-	}
-
-	h := sha256.Sum256(m)
-	x := new(big.Int).SetBytes(h[:])
-	x.Mod(x, p)
-
-	for {
-		xxx := new(big.Int).Mul(x, x)
-		xxx.Mul(xxx, x)
-		xxx.Mod(xxx, p)
-
-		t := new(big.Int).Add(xxx, intCurveB)
-		y := new(big.Int).ModSqrt(t, p)
-		if y != nil {
-			return x, y
-		}
-
-		x.Add(x, big.NewInt(1))
+// HashToCurve sets p to the hash of msg with the domain separation tag dst
+// and returns p. It implements hash_to_curve of RFC 9380 with
+// expand_message_xmd with SHA-256 and the Shallue–van de Woestijne map, which
+// would be the suite BN256G1_XMD:SHA-256_SVDW_RO_ of this curve, in constant
+// time for a given length of msg. Its output differs from Hash.
+func (p *pointG1) HashToCurve(msg, dst []byte) kyber.Point {
+	if p.g == nil {
+		p.g = new(curvePoint)
 	}
+	p.g.Set(hashToCurve(msg, dst))
+	return p
 }
 
 type pointG2 struct {
-	g *twistPoint
+	g          *twistPoint
+	varTime    bool
+	compressed bool
 }
 
 func newPointG2() *pointG2 {
@@ -257,9 +341,13 @@ func newPointG2() *pointG2 {
 }
 
 func (p *pointG2) Equal(q kyber.Point) bool {
-	x, _ := p.MarshalBinary()
-	y, _ := q.MarshalBinary()
-	return subtle.ConstantTimeCompare(x, y) == 1
+	switch pq := q.(type) {
+	case *pointG2:
+		return p.g.Equal(pq.g)
+	case *PreparedG2:
+		return p.g.Equal(pq.p.g)
+	}
+	return false
 }
 
 func (p *pointG2) Null() kyber.Point {
@@ -273,14 +361,13 @@ func (p *pointG2) Base() kyber.Point {
 }
 
 func (p *pointG2) Pick(rand cipher.Stream) kyber.Point {
-	s := mod.NewInt64(0, Order).Pick(rand)
-	p.Base()
-	p.g.Mul(p.g, &s.(*mod.Int).V)
+	s := mod.NewInt256(0, orderModulus).Pick(rand)
+	p.g.mulBase(scalarWords(s))
 	return p
 }
 
 func (p *pointG2) Set(q kyber.Point) kyber.Point {
-	x := q.(*pointG2).g
+	x := toPointG2(q).g
 	p.g.Set(x)
 	return p
 }
@@ -289,6 +376,7 @@ func (p *pointG2) Set(q kyber.Point) kyber.Point {
 func (p *pointG2) Clone() kyber.Point {
 	q := newPointG2()
 	q.g = p.g.Clone()
+	q.compressed = p.compressed
 	return q
 }
 
@@ -305,8 +393,8 @@ func (p *pointG2) Data() ([]byte, error) {
 }
 
 func (p *pointG2) Add(a, b kyber.Point) kyber.Point {
-	x := a.(*pointG2).g
-	y := b.(*pointG2).g
+	x := toPointG2(a).g
+	y := toPointG2(b).g
 	p.g.Add(x, y) // p = a + b
 	return p
 }
@@ -317,51 +405,115 @@ func (p *pointG2) Sub(a, b kyber.Point) kyber.Point {
 }
 
 func (p *pointG2) Neg(q kyber.Point) kyber.Point {
-	x := q.(*pointG2).g
+	x := toPointG2(q).g
 	p.g.Neg(x)
 	return p
 }
 
 func (p *pointG2) Mul(s kyber.Scalar, q kyber.Point) kyber.Point {
+	if metrics.Enabled {
+		defer g2MulCounter.Since(time.Now())
+	}
 	if q == nil {
-		q = newPointG2().Base()
+		p.g.mulBase(scalarWords(s))
+		return p
+	}
+	r := toPointG2(q).g
+	if *r == *twistGen {
+		p.g.mulBase(scalarWords(s))
+		return p
+	}
+	var k scalarBig
+	t := k.set(s)
+	if p.varTime {
+		p.g.mulVartime(r, t)
+	} else {
+		p.g.Mul(r, t)
 	}
-	t := s.(*mod.Int).V
-	r := q.(*pointG2).g
-	p.g.Mul(r, &t)
 	return p
 }
 
+// MultiScalarMul sets p to the sum of scalars[i]·points[i] and returns it. A
+// nil point stands for the base point. It runs in variable time, so only use
+// it on public scalars and points.
+func (p *pointG2) MultiScalarMul(scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("bn256.G2: mismatched number of scalars and points")
+	}
+	if metrics.Enabled {
+		defer g2MultiScalarMulCounter.Since(time.Now())
+	}
+	bs := make([]scalarBig, len(scalars))
+	ks := make([]*big.Int, len(scalars))
+	gs := make([]*twistPoint, len(points))
+	for i, q := range points {
+		ks[i] = bs[i].set(scalars[i])
+		if q == nil {
+			gs[i] = twistGen
+		} else {
+			gs[i] = toPointG2(q).g
+		}
+	}
+	p.g.multiScalarMul(ks, gs)
+	return p
+}
+
+// AllowVarTime sets a flag in this object which determines if a faster
+// but variable time implementation can be used. Set this only on Points
+// which represent public information. Using variable time algorithms to
+// operate on private information can result in timing side-channels.
+func (p *pointG2) AllowVarTime(varTime bool) {
+	p.varTime = varTime
+}
+
 func (p *pointG2) MarshalBinary() ([]byte, error) {
-	// Clone is required as we change the point during the operation
-	p = p.Clone().(*pointG2)
+	return p.AppendBinary(make([]byte, 0, p.MarshalSize()))
+}
 
+// AppendBinary appends the MarshalBinary encoding of p to b and returns the
+// extended buffer. It does not allocate if b has enough spare capacity.
+func (p *pointG2) AppendBinary(b []byte) ([]byte, error) {
 	n := p.ElementSize()
-	if p.g == nil {
-		p.g = &twistPoint{}
+	// Take a copy, as MakeAffine changes the point.
+	var pgtemp twistPoint
+	if p.g != nil {
+		pgtemp = *p.g
 	}
+	pgtemp.MakeAffine()
 
-	p.g.MakeAffine()
-
-	ret := make([]byte, p.MarshalSize())
-	if p.g.IsInfinity() {
-		return ret, nil
+	ret, out := sliceForAppend(b, p.MarshalSize())
+	if p.compressed {
+		marshalTwistCompressed(out, n, &pgtemp)
+	} else {
+		marshalTwistAffine(out, n, &pgtemp)
 	}
-
-	temp := &gfP{}
-	montDecode(temp, &p.g.x.x)
-	temp.Marshal(ret[0*n:])
-	montDecode(temp, &p.g.x.y)
-	temp.Marshal(ret[1*n:])
-	montDecode(temp, &p.g.y.x)
-	temp.Marshal(ret[2*n:])
-	montDecode(temp, &p.g.y.y)
-	temp.Marshal(ret[3*n:])
-
 	return ret, nil
 }
 
+// marshalTwistAffine writes the affine c to out, with n bytes per
+// coordinate. The point at infinity is all zeros.
+func marshalTwistAffine(out []byte, n int, c *twistPoint) {
+	if c.IsInfinity() {
+		zeroBytes(out[:4*n])
+		return
+	}
+	temp := &gfP{}
+	montDecode(temp, &c.x.x)
+	temp.Marshal(out[0*n:])
+	montDecode(temp, &c.x.y)
+	temp.Marshal(out[1*n:])
+	montDecode(temp, &c.y.x)
+	temp.Marshal(out[2*n:])
+	montDecode(temp, &c.y.y)
+	temp.Marshal(out[3*n:])
+}
+
+// MarshalID returns the type tag used in encoding/decoding, which depends on
+// whether the point is compressed.
 func (p *pointG2) MarshalID() [8]byte {
+	if p.compressed {
+		return marshalCompressedPointG2ID
+	}
 	return marshalPointID
 }
 
@@ -382,6 +534,9 @@ func (p *pointG2) UnmarshalBinary(buf []byte) error {
 	if len(buf) < p.MarshalSize() {
 		return errors.New("bn256.G2: not enough data")
 	}
+	if p.compressed {
+		return unmarshalTwistCompressed(p.g, n, buf)
+	}
 
 	p.g.x.x.Unmarshal(buf[0*n:])
 	p.g.x.y.Unmarshal(buf[1*n:])
@@ -404,6 +559,9 @@ func (p *pointG2) UnmarshalBinary(buf []byte) error {
 		if !p.g.IsOnCurve() {
 			return errors.New("bn256.G2: malformed point")
 		}
+		if !p.g.IsInSubgroup() {
+			return errors.New("bn256.G2: point is not in G2")
+		}
 	}
 	return nil
 }
@@ -418,6 +576,9 @@ func (p *pointG2) UnmarshalFrom(r io.Reader) (int, error) {
 }
 
 func (p *pointG2) MarshalSize() int {
+	if p.compressed {
+		return 1 + 2*p.ElementSize()
+	}
 	return 4 * p.ElementSize()
 }
 
@@ -429,8 +590,181 @@ func (p *pointG2) String() string {
 	return "bn256.G2:" + p.g.String()
 }
 
+// PreparedG2 is a G2 point along with the precomputed line functions of its
+// Miller loop, so that pairings with it only need to evaluate them at the G1
+// point. It is meant for long-lived points such as public keys and can be used
+// wherever a G2 point is expected. The methods that modify it prepare the lines
+// of the new point again, which costs about as much as a pairing, so Clone
+// returns an unprepared copy for further computations.
+type PreparedG2 struct {
+	p     *pointG2
+	lines []lineCoeffs // nil for the point at infinity
+}
+
+// NewPreparedG2 precomputes the line functions of the G2 point p.
+func NewPreparedG2(p kyber.Point) *PreparedG2 {
+	q := toPointG2(p).Clone().(*pointG2)
+	return &PreparedG2{p: q, lines: g2Lines(q)}
+}
+
+// Point returns a copy of the prepared point, without the lines.
+func (pp *PreparedG2) Point() kyber.Point {
+	return pp.p.Clone()
+}
+
+// prepare recomputes the lines after pp.p changed and returns pp.
+func (pp *PreparedG2) prepare() kyber.Point {
+	pp.lines = g2Lines(pp.p)
+	return pp
+}
+
+func (pp *PreparedG2) Equal(q kyber.Point) bool {
+	return pp.p.Equal(q)
+}
+
+func (pp *PreparedG2) Null() kyber.Point {
+	pp.p.Null()
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) Base() kyber.Point {
+	pp.p.Base()
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) Pick(rand cipher.Stream) kyber.Point {
+	pp.p.Pick(rand)
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) Set(q kyber.Point) kyber.Point {
+	pp.p.Set(q)
+	return pp.prepare()
+}
+
+// Clone returns a copy of the point as an unprepared G2 point, like Point.
+func (pp *PreparedG2) Clone() kyber.Point {
+	return pp.p.Clone()
+}
+
+func (pp *PreparedG2) EmbedLen() int {
+	return pp.p.EmbedLen()
+}
+
+func (pp *PreparedG2) Embed(data []byte, rand cipher.Stream) kyber.Point {
+	pp.p.Embed(data, rand)
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) Data() ([]byte, error) {
+	return pp.p.Data()
+}
+
+func (pp *PreparedG2) Add(a, b kyber.Point) kyber.Point {
+	pp.p.Add(a, b)
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) Sub(a, b kyber.Point) kyber.Point {
+	pp.p.Sub(a, b)
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) Neg(q kyber.Point) kyber.Point {
+	pp.p.Neg(q)
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) Mul(s kyber.Scalar, q kyber.Point) kyber.Point {
+	pp.p.Mul(s, q)
+	return pp.prepare()
+}
+
+func (pp *PreparedG2) MarshalBinary() ([]byte, error) {
+	return pp.p.MarshalBinary()
+}
+
+// AppendBinary appends the MarshalBinary encoding of pp to b, see
+// pointG2.AppendBinary.
+func (pp *PreparedG2) AppendBinary(b []byte) ([]byte, error) {
+	return pp.p.AppendBinary(b)
+}
+
+func (pp *PreparedG2) MarshalID() [8]byte {
+	return pp.p.MarshalID()
+}
+
+func (pp *PreparedG2) MarshalTo(w io.Writer) (int, error) {
+	return pp.p.MarshalTo(w)
+}
+
+func (pp *PreparedG2) UnmarshalBinary(buf []byte) error {
+	if err := pp.p.UnmarshalBinary(buf); err != nil {
+		return err
+	}
+	pp.prepare()
+	return nil
+}
+
+func (pp *PreparedG2) UnmarshalFrom(r io.Reader) (int, error) {
+	n, err := pp.p.UnmarshalFrom(r)
+	if err == nil {
+		pp.prepare()
+	}
+	return n, err
+}
+
+func (pp *PreparedG2) MarshalSize() int {
+	return pp.p.MarshalSize()
+}
+
+func (pp *PreparedG2) ElementSize() int {
+	return pp.p.ElementSize()
+}
+
+func (pp *PreparedG2) String() string {
+	return pp.p.String()
+}
+
+// toPointG2 returns the pointG2 underlying p, which may be prepared.
+func toPointG2(p kyber.Point) *pointG2 {
+	if pp, ok := p.(*PreparedG2); ok {
+		return pp.p
+	}
+	return p.(*pointG2)
+}
+
+var twistGenLines struct {
+	once  sync.Once
+	lines []lineCoeffs
+}
+
+// g2Lines returns the line functions of the Miller loop for p. They are cached
+// for prepared points and the generator.
+func g2Lines(p kyber.Point) []lineCoeffs {
+	if pp, ok := p.(*PreparedG2); ok {
+		return pp.lines
+	}
+
+	g := p.(*pointG2).g
+	switch {
+	case g.IsInfinity():
+		return nil
+	case *g == *twistGen:
+		twistGenLines.once.Do(func() {
+			twistGenLines.lines = prepareLines(twistGen)
+		})
+		return twistGenLines.lines
+	}
+	return prepareLines(g)
+}
+
 type pointGT struct {
 	g *gfP12
+	// cyclotomic is set when g is known to lie in the cyclotomic subgroup,
+	// i.e. for finalized pairings, so that Mul may use CyclotomicExp. Miller
+	// loops and unmarshaled values are not known to be in it.
+	cyclotomic bool
 }
 
 func newPointGT() *pointGT {
@@ -446,24 +780,28 @@ func (p *pointGT) Equal(q kyber.Point) bool {
 
 func (p *pointGT) Null() kyber.Point {
 	p.g.Set(gfP12Inf)
+	p.cyclotomic = true
 	return p
 }
 
 func (p *pointGT) Base() kyber.Point {
 	p.g.Set(gfP12Gen)
+	p.cyclotomic = true
 	return p
 }
 
 func (p *pointGT) Pick(rand cipher.Stream) kyber.Point {
-	s := mod.NewInt64(0, Order).Pick(rand)
+	s := mod.NewInt256(0, orderModulus).Pick(rand)
 	p.Base()
-	p.g.Exp(p.g, &s.(*mod.Int).V)
+	var k scalarBig
+	p.g.CyclotomicExp(p.g, k.set(s))
 	return p
 }
 
 func (p *pointGT) Set(q kyber.Point) kyber.Point {
-	x := q.(*pointGT).g
-	p.g.Set(x)
+	x := q.(*pointGT)
+	p.g.Set(x.g)
+	p.cyclotomic = x.cyclotomic
 	return p
 }
 
@@ -471,6 +809,7 @@ func (p *pointGT) Set(q kyber.Point) kyber.Point {
 func (p *pointGT) Clone() kyber.Point {
 	q := newPointGT()
 	q.g = p.g.Clone()
+	q.cyclotomic = p.cyclotomic
 	return q
 }
 
@@ -487,9 +826,10 @@ func (p *pointGT) Data() ([]byte, error) {
 }
 
 func (p *pointGT) Add(a, b kyber.Point) kyber.Point {
-	x := a.(*pointGT).g
-	y := b.(*pointGT).g
-	p.g.Mul(x, y)
+	x := a.(*pointGT)
+	y := b.(*pointGT)
+	p.g.Mul(x.g, y.g)
+	p.cyclotomic = x.cyclotomic && y.cyclotomic
 	return p
 }
 
@@ -499,24 +839,40 @@ func (p *pointGT) Sub(a, b kyber.Point) kyber.Point {
 }
 
 func (p *pointGT) Neg(q kyber.Point) kyber.Point {
-	x := q.(*pointGT).g
-	p.g.Conjugate(x)
+	x := q.(*pointGT)
+	p.g.Conjugate(x.g)
+	p.cyclotomic = x.cyclotomic
 	return p
 }
 
 func (p *pointGT) Mul(s kyber.Scalar, q kyber.Point) kyber.Point {
+	if metrics.Enabled {
+		defer gtMulCounter.Since(time.Now())
+	}
 	if q == nil {
 		q = newPointGT().Base()
 	}
-	t := s.(*mod.Int).V
-	r := q.(*pointGT).g
-	p.g.Exp(r, &t)
+	var k scalarBig
+	t := k.set(s)
+	r := q.(*pointGT)
+	if r.cyclotomic {
+		p.g.CyclotomicExp(r.g, t)
+	} else {
+		p.g.Exp(r.g, t)
+	}
+	p.cyclotomic = r.cyclotomic
 	return p
 }
 
 func (p *pointGT) MarshalBinary() ([]byte, error) {
+	return p.AppendBinary(make([]byte, 0, p.MarshalSize()))
+}
+
+// AppendBinary appends the MarshalBinary encoding of p to b and returns the
+// extended buffer. It does not allocate if b has enough spare capacity.
+func (p *pointGT) AppendBinary(b []byte) ([]byte, error) {
 	n := p.ElementSize()
-	ret := make([]byte, p.MarshalSize())
+	b, ret := sliceForAppend(b, p.MarshalSize())
 	temp := &gfP{}
 
 	montDecode(temp, &p.g.x.x.x)
@@ -544,7 +900,7 @@ func (p *pointGT) MarshalBinary() ([]byte, error) {
 	montDecode(temp, &p.g.y.z.y)
 	temp.Marshal(ret[11*n:])
 
-	return ret, nil
+	return b, nil
 }
 
 func (p *pointGT) MarshalTo(w io.Writer) (int, error) {
@@ -589,6 +945,7 @@ func (p *pointGT) UnmarshalBinary(buf []byte) error {
 	montEncode(&p.g.y.y.y, &p.g.y.y.y)
 	montEncode(&p.g.y.z.x, &p.g.y.z.x)
 	montEncode(&p.g.y.z.y, &p.g.y.z.y)
+	p.cyclotomic = false
 
 	// TODO: check if point is on curve
 
@@ -617,21 +974,49 @@ func (p *pointGT) String() string {
 }
 
 func (p *pointGT) Finalize() kyber.Point {
-	buf := finalExponentiation(p.g)
-	p.g.Set(buf)
+	finalExponentiation(p.g, p.g)
+	p.cyclotomic = true
 	return p
 }
 
 func (p *pointGT) Miller(p1, p2 kyber.Point) kyber.Point {
-	a := p1.(*pointG1).g
-	b := p2.(*pointG2).g
-	p.g.Set(miller(b, a))
+	c := pairingContexts.Get().(*PairingContext)
+	c.Miller(p, p1, p2)
+	pairingContexts.Put(c)
+	return p
+}
+
+// MultiMiller sets p to the product of the Miller loops of the pairs of
+// p1s[i] and p2s[i]. Products of Miller loops can be multiplied with Add, and
+// Finalize turns them into the product of the pairings, so that the loops of a
+// multi-pairing can be computed separately, e.g. by several goroutines.
+func (p *pointGT) MultiMiller(p1s, p2s []kyber.Point) kyber.Point {
+	c := pairingContexts.Get().(*PairingContext)
+	c.MultiMiller(p, p1s, p2s)
+	pairingContexts.Put(c)
 	return p
 }
 
+// MillerPrepared computes the Miller loop of p1 and a prepared G2 point,
+// evaluating the cached line functions at p1.
+func (p *pointGT) MillerPrepared(p1 kyber.Point, p2 *PreparedG2) kyber.Point {
+	return p.Miller(p1, p2)
+}
+
 func (p *pointGT) Pair(p1, p2 kyber.Point) kyber.Point {
-	a := p1.(*pointG1).g
-	b := p2.(*pointG2).g
-	p.g.Set(optimalAte(b, a))
+	c := pairingContexts.Get().(*PairingContext)
+	c.Pair(p, p1, p2)
+	pairingContexts.Put(c)
+	return p
+}
+
+// MultiPair sets p to the product of the pairings e(p1s[i], p2s[i]). The
+// Miller loops share their squarings and a single final exponentiation, which
+// is much cheaper than multiplying separately computed pairings. The G2 points
+// may be prepared, see PreparedG2.
+func (p *pointGT) MultiPair(p1s, p2s []kyber.Point) kyber.Point {
+	c := pairingContexts.Get().(*PairingContext)
+	c.MultiPair(p, p1s, p2s)
+	pairingContexts.Put(c)
 	return p
 }
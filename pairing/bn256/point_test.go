@@ -2,7 +2,9 @@ package bn256
 
 import (
 	"bytes"
+	"crypto/rand"
 	"encoding/hex"
+	"math/big"
 	"testing"
 )
 
@@ -39,3 +41,285 @@ func TestPointG1_HashToPoint(t *testing.T) {
 		t.Error("hash does not match reference")
 	}
 }
+
+// mulScalars returns the scalars that TestCurvePointMul and TestTwistPointMul
+// check, which include the edge cases of the decompositions.
+func mulScalars(t *testing.T) []*big.Int {
+	ks := []*big.Int{
+		big.NewInt(0),
+		big.NewInt(1),
+		big.NewInt(2),
+		new(big.Int).Sub(Order, big.NewInt(1)),
+		new(big.Int).Set(Order),
+		new(big.Int).Set(glvLambda),
+		new(big.Int).Add(glvLambda, big.NewInt(1)),
+		new(big.Int).Set(psiLambda),
+		new(big.Int).Add(psiLambda, big.NewInt(2)),
+		new(big.Int).Lsh(big.NewInt(1), 255),
+	}
+	for i := 0; i < 20; i++ {
+		k, err := rand.Int(rand.Reader, Order)
+		if err != nil {
+			t.Fatal(err)
+		}
+		ks = append(ks, k)
+	}
+	return ks
+}
+
+func TestExpandMessageXMD(t *testing.T) {
+	// Test vectors of RFC 9380, section K.1.
+	dst := []byte("QUUX-V01-CS02-with-expander-SHA256-128")
+	vectors := []struct{ msg, out string }{
+		{"", "68a985b87eb6b46952128911f2a4412bbc302a9d759667f87f7a21d803f07235"},
+		{"abc", "d8ccab23b5985ccea865c6c97b6e5b8350e794e603b4b97902f53a8a0d605615"},
+	}
+	for _, v := range vectors {
+		out := hex.EncodeToString(expandMessageXMD([]byte(v.msg), dst, 32))
+		if out != v.out {
+			t.Errorf("expandMessageXMD(%q) = %s, want %s", v.msg, out, v.out)
+		}
+	}
+}
+
+func TestPointG1_HashToCurve(t *testing.T) {
+	// The exceptional inputs of the map, 0 and the roots of 1 - 4u² = 0,
+	// must land on the curve as well.
+	half := &gfP{}
+	half.Invert(newGFp(2))
+	for _, u := range []*gfP{{}, newGFp(1), half, randomGFp(), randomGFp()} {
+		c := &curvePoint{}
+		c.mapToCurve(u)
+		if !c.IsOnCurve() {
+			t.Fatalf("mapToCurve(%s) is not on the curve", u)
+		}
+	}
+
+	dst := []byte("QUUX-V01-CS02-with-BN256G1_XMD:SHA-256_SVDW_RO_")
+	p := new(pointG1).HashToCurve([]byte("abc"), dst)
+	if !p.(*pointG1).g.IsOnCurve() {
+		t.Fatal("HashToCurve is not on the curve")
+	}
+	if !p.Equal(new(pointG1).HashToCurve([]byte("abc"), dst)) {
+		t.Error("HashToCurve is not deterministic")
+	}
+	if p.Equal(new(pointG1).HashToCurve([]byte("abd"), dst)) {
+		t.Error("HashToCurve does not depend on the message")
+	}
+	if p.Equal(new(pointG1).HashToCurve([]byte("abc"), []byte("other"))) {
+		t.Error("HashToCurve does not depend on the tag")
+	}
+}
+
+func TestCurvePointMul(t *testing.T) {
+	p := &curvePoint{}
+	p.phi(curveGen)
+	want := &curvePoint{}
+	want.mulDoubleAndAdd(curveGen, glvLambda)
+	p.MakeAffine()
+	want.MakeAffine()
+	if *p != *want {
+		t.Fatal("φ(G) != λG")
+	}
+
+	a := &curvePoint{}
+	a.mulDoubleAndAdd(curveGen, big.NewInt(12345))
+	for _, k := range mulScalars(t) {
+		k1, k2 := glvDecompose(k)
+		if k1.BitLen() > 128 || k2.BitLen() > 128 {
+			t.Fatalf("glvDecompose(%v) = %v, %v", k, k1, k2)
+		}
+
+		want.mulDoubleAndAdd(a, k)
+		want.MakeAffine()
+		got := &curvePoint{}
+		got.Mul(a, k)
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("Mul(%v) = %v, want %v", k, got, want)
+		}
+		got.mulVartime(a, k)
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("mulVartime(%v) = %v, want %v", k, got, want)
+		}
+	}
+}
+
+func TestTwistPointMul(t *testing.T) {
+	p := &twistPoint{}
+	p.psi(twistGen)
+	want := &twistPoint{}
+	want.mulDoubleAndAdd(twistGen, psiLambda)
+	p.MakeAffine()
+	want.MakeAffine()
+	if *p != *want {
+		t.Fatal("ψ(G) != 6u²G")
+	}
+
+	a := &twistPoint{}
+	a.mulDoubleAndAdd(twistGen, big.NewInt(12345))
+	for _, k := range mulScalars(t) {
+		want.mulDoubleAndAdd(a, k)
+		want.MakeAffine()
+		got := &twistPoint{}
+		got.Mul(a, k)
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("Mul(%v) = %v, want %v", k, got, want)
+		}
+		got.mulVartime(a, k)
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("mulVartime(%v) = %v, want %v", k, got, want)
+		}
+	}
+}
+
+// randomTwistPoint returns a random point on the twist curve, which is almost
+// certainly not in G₂.
+func randomTwistPoint() *twistPoint {
+	for {
+		c := &twistPoint{x: *randomGFp2()}
+		rhs := &gfP2{}
+		rhs.Square(&c.x).Mul(rhs, &c.x).Add(rhs, twistB)
+		if c.y.Sqrt(rhs) {
+			c.z.SetOne()
+			c.t.SetOne()
+			return c
+		}
+	}
+}
+
+func TestTwistPointIsInSubgroup(t *testing.T) {
+	inf := &twistPoint{}
+	inf.SetInfinity()
+	if !inf.IsInSubgroup() || !twistGen.IsInSubgroup() {
+		t.Fatal("the point at infinity or the generator is not in G2")
+	}
+
+	for _, k := range mulScalars(t) {
+		c := &twistPoint{}
+		c.Mul(twistGen, k)
+		if !c.IsInSubgroup() {
+			t.Fatalf("%v·G is not in G2", k)
+		}
+	}
+
+	for i := 0; i < 10; i++ {
+		c := randomTwistPoint()
+		if !c.IsOnCurve() {
+			t.Fatalf("%s is not on the curve", c)
+		}
+		n := &twistPoint{}
+		n.mulDoubleAndAdd(c, Order)
+		if c.IsInSubgroup() != n.IsInfinity() {
+			t.Fatalf("IsInSubgroup(%s) = %v, but Order·c is %s", c, c.IsInSubgroup(), n)
+		}
+	}
+}
+
+func TestCurvePointMulBase(t *testing.T) {
+	for _, k := range mulScalars(t) {
+		want := &curvePoint{}
+		want.mulDoubleAndAdd(curveGen, k)
+		want.MakeAffine()
+		got := &curvePoint{}
+		got.mulBase(orderWordsMod(k))
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("mulBase(%v) = %v, want %v", k, got, want)
+		}
+	}
+}
+
+func TestTwistPointMulBase(t *testing.T) {
+	for _, k := range mulScalars(t) {
+		want := &twistPoint{}
+		want.mulDoubleAndAdd(twistGen, k)
+		want.MakeAffine()
+		got := &twistPoint{}
+		got.mulBase(orderWordsMod(k))
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("mulBase(%v) = %v, want %v", k, got, want)
+		}
+	}
+}
+
+func TestCurvePointMultiScalarMul(t *testing.T) {
+	// The sizes cover both Straus' and Pippenger's method.
+	for _, n := range []int{0, 1, 5, msmStrausMax / 2, 100} {
+		ks := make([]*big.Int, n)
+		ps := make([]*curvePoint, n)
+		want, term := &curvePoint{}, &curvePoint{}
+		want.SetInfinity()
+		for i := range ks {
+			ks[i] = mulScalars(t)[i%20+10]
+			ps[i] = &curvePoint{}
+			ps[i].mulBase([4]uint64{uint64(i + 1)})
+			term.mulDoubleAndAdd(ps[i], ks[i])
+			want.Add(want, term)
+		}
+		want.MakeAffine()
+
+		got := &curvePoint{}
+		got.multiScalarMul(ks, ps)
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("multiScalarMul of %d terms = %v, want %v", n, got, want)
+		}
+	}
+}
+
+func TestTwistPointMultiScalarMul(t *testing.T) {
+	for _, n := range []int{0, 1, 5, msmStrausMax / 2, 100} {
+		ks := make([]*big.Int, n)
+		ps := make([]*twistPoint, n)
+		want, term := &twistPoint{}, &twistPoint{}
+		want.SetInfinity()
+		for i := range ks {
+			ks[i] = mulScalars(t)[i%20+10]
+			ps[i] = &twistPoint{}
+			ps[i].mulBase([4]uint64{uint64(i + 1)})
+			term.mulDoubleAndAdd(ps[i], ks[i])
+			want.Add(want, term)
+		}
+		want.MakeAffine()
+
+		got := &twistPoint{}
+		got.multiScalarMul(ks, ps)
+		got.MakeAffine()
+		if *got != *want {
+			t.Fatalf("multiScalarMul of %d terms = %v, want %v", n, got, want)
+		}
+	}
+}
+
+func (c *curvePoint) mulDoubleAndAdd(a *curvePoint, scalar *big.Int) {
+	sum, t := &curvePoint{}, &curvePoint{}
+	sum.SetInfinity()
+	for i := scalar.BitLen(); i >= 0; i-- {
+		t.Double(sum)
+		if scalar.Bit(i) != 0 {
+			sum.Add(t, a)
+		} else {
+			sum.Set(t)
+		}
+	}
+	c.Set(sum)
+}
+
+func (c *twistPoint) mulDoubleAndAdd(a *twistPoint, scalar *big.Int) {
+	sum, t := &twistPoint{}, &twistPoint{}
+	sum.SetInfinity()
+	for i := scalar.BitLen(); i >= 0; i-- {
+		t.Double(sum)
+		if scalar.Bit(i) != 0 {
+			sum.Add(t, a)
+		} else {
+			sum.Set(t)
+		}
+	}
+	c.Set(sum)
+}
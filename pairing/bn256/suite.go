@@ -2,13 +2,13 @@ package bn256
 
 import (
 	"crypto/cipher"
-	"crypto/sha256"
 	"hash"
 	"io"
 	"reflect"
 
 	"go.dedis.ch/fixbuf"
 	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/hashpool"
 	"go.dedis.ch/kyber/v3/util/random"
 	"go.dedis.ch/kyber/v3/xof/blake2xb"
 )
@@ -30,6 +30,19 @@ func NewSuite() *Suite {
 	return s
 }
 
+// NewSuiteCompressed returns a new BN256 pairing suite whose G1 and G2 points
+// use the compressed encoding: their x coordinate and the sign of y, in 33
+// and 65 instead of 64 and 128 bytes. Decoding them takes a square root, and
+// so is slower. Its points work with those of the other suites, but their
+// encodings are not compatible.
+func NewSuiteCompressed() *Suite {
+	s := &Suite{commonSuite: &commonSuite{compressed: true}}
+	s.g1 = &groupG1{commonSuite: s.commonSuite, compressed: true}
+	s.g2 = &groupG2{commonSuite: s.commonSuite, compressed: true}
+	s.gt = &groupGT{commonSuite: s.commonSuite}
+	return s
+}
+
 // NewSuiteG1 returns a G1 suite.
 func NewSuiteG1() *Suite {
 	s := NewSuite()
@@ -82,6 +95,22 @@ func (s *Suite) Pair(p1 kyber.Point, p2 kyber.Point) kyber.Point {
 	return s.GT().Point().(*pointGT).Pair(p1, p2)
 }
 
+// MultiPair takes the points p1s[i] in G1 and p2s[i] in G2 as input and
+// computes the product of their pairings in GT, sharing one final
+// exponentiation between them.
+func (s *Suite) MultiPair(p1s, p2s []kyber.Point) kyber.Point {
+	return s.GT().Point().(*pointGT).MultiPair(p1s, p2s)
+}
+
+// PairingCheck returns whether the product of the pairings e(p1s[i], p2s[i])
+// is the identity of GT.
+func (s *Suite) PairingCheck(p1s, p2s []kyber.Point) bool {
+	c := pairingContexts.Get().(*PairingContext)
+	ok := c.PairingCheck(p1s, p2s)
+	pairingContexts.Put(c)
+	return ok
+}
+
 // Not used other than for reflect.TypeOf()
 var aScalar kyber.Scalar
 var aPoint kyber.Point
@@ -96,7 +125,8 @@ var tPointG2 = reflect.TypeOf(&aPointG2).Elem()
 var tPointGT = reflect.TypeOf(&aPointGT).Elem()
 
 type commonSuite struct {
-	s cipher.Stream
+	s          cipher.Stream
+	compressed bool
 	// kyber.Group is only set if we have a combined Suite
 	kyber.Group
 }
@@ -109,10 +139,10 @@ func (c *commonSuite) New(t reflect.Type) interface{} {
 	case tPoint:
 		return c.Point()
 	case tPointG1:
-		g1 := groupG1{}
+		g1 := groupG1{compressed: c.compressed}
 		return g1.Point()
 	case tPointG2:
-		g2 := groupG2{}
+		g2 := groupG2{compressed: c.compressed}
 		return g2.Point()
 	case tPointGT:
 		gt := groupGT{}
@@ -121,24 +151,89 @@ func (c *commonSuite) New(t reflect.Type) interface{} {
 	return nil
 }
 
-// Read is the default implementation of kyber.Encoding interface Read.
+// Read is the default implementation of kyber.Encoding interface Read. If
+// all objs are points or scalars, they are read with a single read into one
+// buffer; otherwise they are decoded with fixbuf.
 func (c *commonSuite) Read(r io.Reader, objs ...interface{}) error {
-	return fixbuf.Read(r, c, objs...)
+	if _, ok := r.(cipher.Stream); ok {
+		// fixbuf picks the objects from a stream.
+		return fixbuf.Read(r, c, objs...)
+	}
+	size := 0
+	for _, obj := range objs {
+		m, ok := obj.(kyber.Marshaling)
+		if !ok {
+			return fixbuf.Read(r, c, objs...)
+		}
+		size += m.MarshalSize()
+	}
+
+	buf := make([]byte, size)
+	if _, err := io.ReadFull(r, buf); err != nil {
+		return err
+	}
+	for _, obj := range objs {
+		m := obj.(kyber.Marshaling)
+		n := m.MarshalSize()
+		if err := m.UnmarshalBinary(buf[:n]); err != nil {
+			return err
+		}
+		buf = buf[n:]
+	}
+	return nil
 }
 
-// Write is the default implementation of kyber.Encoding interface Write.
+// Write is the default implementation of kyber.Encoding interface Write. If
+// all objs are points or scalars that implement kyber.BinaryAppender, they
+// are encoded into one buffer and written with a single write; otherwise
+// they are encoded with fixbuf.
 func (c *commonSuite) Write(w io.Writer, objs ...interface{}) error {
-	return fixbuf.Write(w, objs)
+	size := 0
+	for _, obj := range objs {
+		m, ok := obj.(appendMarshaler)
+		if !ok {
+			return fixbuf.Write(w, objs)
+		}
+		size += m.MarshalSize()
+	}
+
+	buf := make([]byte, 0, size)
+	for _, obj := range objs {
+		var err error
+		if buf, err = obj.(appendMarshaler).AppendBinary(buf); err != nil {
+			return err
+		}
+	}
+	_, err := w.Write(buf)
+	return err
 }
 
-// Hash returns a newly instantiated sha256 hash function.
+// appendMarshaler is a kyber.Marshaling that is also a kyber.BinaryAppender.
+type appendMarshaler interface {
+	kyber.Marshaling
+	kyber.BinaryAppender
+}
+
+// Hash returns a SHA-256 hash, reusing one given back to PutHash if there is
+// any.
 func (c *commonSuite) Hash() hash.Hash {
-	return sha256.New()
+	return hashpool.SHA256()
+}
+
+// PutHash gives back h, which must no longer be used, for Hash to reuse.
+func (c *commonSuite) PutHash(h hash.Hash) {
+	hashpool.Put(h)
 }
 
-// XOF returns a newlly instantiated blake2xb XOF function.
+// XOF returns an XOF implemented with Blake2b, reusing one given back to
+// PutXOF if there is any.
 func (c *commonSuite) XOF(seed []byte) kyber.XOF {
-	return blake2xb.New(seed)
+	return blake2xb.Get(seed)
+}
+
+// PutXOF gives back x, which must no longer be used, for XOF to reuse.
+func (c *commonSuite) PutXOF(x kyber.XOF) {
+	blake2xb.Put(x)
 }
 
 // RandomStream returns a cipher.Stream which corresponds to a key stream from
@@ -1,10 +1,12 @@
 package bn256
 
 import (
+	"bytes"
 	"fmt"
 	"testing"
 
 	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/mod"
 	"go.dedis.ch/kyber/v3/util/random"
 	"golang.org/x/crypto/bn256"
@@ -66,7 +68,7 @@ func TestG1(t *testing.T) {
 	ma, err := pa.MarshalBinary()
 	require.Nil(t, err)
 
-	pb := new(bn256.G1).ScalarBaseMult(&k.(*mod.Int).V)
+	pb := new(bn256.G1).ScalarBaseMult(k.(*mod.Int256).BigInt())
 	mb := pb.Marshal()
 
 	require.Equal(t, ma, mb)
@@ -110,15 +112,52 @@ func TestG1Ops(t *testing.T) {
 	}
 }
 
+func TestPointEqual(t *testing.T) {
+	suite := NewSuite()
+	g1 := suite.G1().Point().Pick(random.New())
+	g2 := suite.G2().Point().Pick(random.New())
+
+	// Points of another group are never equal, even the identities.
+	require.False(t, g1.Equal(g2))
+	require.False(t, g2.Equal(g1))
+	require.False(t, suite.G1().Point().Null().Equal(suite.G2().Point().Null()))
+	require.False(t, g1.Equal(suite.GT().Point()))
+
+	// The same points with different Jacobian coordinates are equal.
+	l, ll, lll := newGFp(7), &gfP{}, &gfP{}
+	gfpSqr(ll, l)
+	gfpMul(lll, ll, l)
+	a1 := g1.Clone().(*pointG1)
+	gfpMul(&a1.g.x, &a1.g.x, ll)
+	gfpMul(&a1.g.y, &a1.g.y, lll)
+	gfpMul(&a1.g.z, &a1.g.z, l)
+	require.True(t, a1.Equal(g1))
+	require.True(t, g1.Equal(a1))
+	a1.g.y.Set(&g1.(*pointG1).g.y)
+	require.False(t, a1.Equal(g1))
+	require.False(t, g1.Equal(suite.G1().Point().Null()))
+	require.True(t, suite.G1().Point().Null().Equal(suite.G1().Point().Sub(g1, g1)))
+
+	a2 := g2.Clone().(*pointG2)
+	a2.g.Double(a2.g)
+	b2 := g2.Clone().(*pointG2)
+	b2.g.MakeAffine()
+	b2.g.Double(b2.g)
+	require.True(t, a2.Equal(b2))
+	require.False(t, a2.Equal(g2))
+	require.False(t, suite.G2().Point().Null().Equal(a2))
+	require.True(t, suite.G2().Point().Null().Equal(suite.G2().Point().Sub(g2, g2)))
+}
+
 func TestG2(t *testing.T) {
 	suite := NewSuite()
 	k := suite.G2().Scalar().Pick(random.New())
-	require.Equal(t, "mod.int ", fmt.Sprintf("%s", k.(*mod.Int).MarshalID()))
+	require.Equal(t, "mod.int ", fmt.Sprintf("%s", k.(*mod.Int256).MarshalID()))
 	pa := suite.G2().Point().Mul(k, nil)
 	require.Equal(t, "bn256.g2", fmt.Sprintf("%s", pa.(*pointG2).MarshalID()))
 	ma, err := pa.MarshalBinary()
 	require.Nil(t, err)
-	pb := new(bn256.G2).ScalarBaseMult(&k.(*mod.Int).V)
+	pb := new(bn256.G2).ScalarBaseMult(k.(*mod.Int256).BigInt())
 	mb := pb.Marshal()
 	require.Equal(t, ma, mb)
 }
@@ -183,7 +222,7 @@ func TestGT(t *testing.T) {
 	if !ok {
 		t.Fatal("unmarshal not ok")
 	}
-	pb.ScalarMult(pb, &k.(*mod.Int).V)
+	pb.ScalarMult(pb, k.(*mod.Int256).BigInt())
 	mb := pb.Marshal()
 	require.Equal(t, ma, mb)
 }
@@ -236,6 +275,382 @@ func TestBilinearity(t *testing.T) {
 	require.Equal(t, pc, pd)
 }
 
+// Miller loops are not in the cyclotomic subgroup, so that GT.Mul must not
+// use cyclotomic squarings on them before the final exponentiation.
+func TestGTMulMiller(t *testing.T) {
+	suite := NewSuite()
+	k := suite.GT().Scalar().Pick(random.New())
+	p1 := suite.G1().Point().Pick(random.New())
+	p2 := suite.G2().Point().Pick(random.New())
+
+	gt := suite.GT().Point().(*pointGT).Miller(p1, p2)
+	gt = suite.GT().Point().Mul(k, gt)
+	gt = gt.(*pointGT).Finalize()
+	want := suite.GT().Point().Mul(k, suite.Pair(p1, p2))
+	require.True(t, want.Equal(gt))
+
+	// Nor is an arbitrary element of GF(p¹²) decoded by UnmarshalBinary.
+	buf, err := suite.GT().Point().(*pointGT).Miller(p1, p2).MarshalBinary()
+	require.NoError(t, err)
+	gt = suite.GT().Point()
+	require.NoError(t, gt.UnmarshalBinary(buf))
+	gt = suite.GT().Point().Mul(k, gt)
+	require.True(t, want.Equal(gt.(*pointGT).Finalize()))
+}
+
+func TestMultiPair(t *testing.T) {
+	suite := NewSuite()
+	p1s := make([]kyber.Point, 4)
+	p2s := make([]kyber.Point, 4)
+	want := suite.GT().Point().Null()
+	for i := range p1s {
+		p1s[i] = suite.G1().Point().Pick(random.New())
+		p2s[i] = suite.G2().Point().Pick(random.New())
+		want.Add(want, suite.Pair(p1s[i], p2s[i]))
+	}
+	// A point at infinity contributes a factor of one.
+	p1s = append(p1s, suite.G1().Point().Null())
+	p2s = append(p2s, suite.G2().Point().Pick(random.New()))
+
+	require.Equal(t, want, suite.MultiPair(p1s, p2s))
+	require.Equal(t, suite.GT().Point().Null(), suite.MultiPair(nil, nil))
+}
+
+func TestPairingCheck(t *testing.T) {
+	suite := NewSuite()
+	a := suite.G1().Scalar().Pick(random.New())
+	b := suite.G2().Scalar().Pick(random.New())
+	ab := suite.G1().Scalar().Mul(a, b)
+
+	// e(a·B1, b·B2)·e(-ab·B1, B2) == 1
+	p1s := []kyber.Point{
+		suite.G1().Point().Mul(a, nil),
+		suite.G1().Point().Neg(suite.G1().Point().Mul(ab, nil)),
+	}
+	p2s := []kyber.Point{
+		suite.G2().Point().Mul(b, nil),
+		suite.G2().Point().Base(),
+	}
+	require.True(t, suite.PairingCheck(p1s, p2s))
+
+	p2s[1] = suite.G2().Point().Pick(random.New())
+	require.False(t, suite.PairingCheck(p1s, p2s))
+}
+
+func TestPreparedG2(t *testing.T) {
+	suite := NewSuite()
+	p1 := suite.G1().Point().Pick(random.New())
+	p2 := suite.G2().Point().Pick(random.New())
+	prep := NewPreparedG2(p2)
+
+	require.True(t, prep.Equal(p2))
+	require.Equal(t, suite.Pair(p1, p2), suite.Pair(p1, prep))
+
+	gt := suite.GT().Point().(*pointGT)
+	want := suite.GT().Point().(*pointGT).Miller(p1, p2)
+	require.Equal(t, want, gt.MillerPrepared(p1, prep))
+
+	// Prepared points can be mixed with unprepared ones and be used as
+	// arguments of G2 operations.
+	p1s := []kyber.Point{p1, suite.G1().Point().Neg(p1)}
+	p2s := []kyber.Point{prep, suite.G2().Point().Set(prep)}
+	require.True(t, suite.PairingCheck(p1s, p2s))
+
+	inf := NewPreparedG2(suite.G2().Point().Null())
+	require.Equal(t, suite.GT().Point().Null(), suite.Pair(p1, inf))
+
+	// Copies are unprepared and do not change the prepared point, which is
+	// prepared again when it is modified.
+	q := prep.Point()
+	q.Add(q, p2)
+	require.True(t, prep.Equal(p2))
+	require.Equal(t, suite.Pair(p1, p2), suite.Pair(p1, prep))
+	_, ok := prep.Clone().(*pointG2)
+	require.True(t, ok)
+	prep.Add(prep, p2)
+	require.True(t, prep.Equal(q))
+	require.Equal(t, suite.Pair(p1, q), suite.Pair(p1, prep))
+	buf, err := p2.MarshalBinary()
+	require.NoError(t, err)
+	require.NoError(t, prep.UnmarshalBinary(buf))
+	require.Equal(t, suite.Pair(p1, p2), suite.Pair(p1, prep))
+}
+
+func TestPairingContext(t *testing.T) {
+	suite := NewSuite()
+	ctx := NewPairingContext()
+	p1 := suite.G1().Point().Pick(random.New())
+	p2 := suite.G2().Point().Pick(random.New())
+	prep := NewPreparedG2(p2)
+
+	// A context gives the same results as the suite, also when reused for a
+	// different number of pairs.
+	for i := 0; i < 2; i++ {
+		gt := suite.GT().Point()
+		require.Equal(t, suite.Pair(p1, p2), ctx.Pair(gt, p1, p2))
+		require.Equal(t, suite.Pair(p1, p2), ctx.Pair(gt, p1, prep))
+		require.Equal(t, suite.GT().Point().(*pointGT).Miller(p1, p2), ctx.Miller(gt, p1, p2))
+
+		p1s := []kyber.Point{p1, suite.G1().Point().Base(), suite.G1().Point().Null()}
+		p2s := []kyber.Point{p2, p2, suite.G2().Point().Base()}
+		require.Equal(t, suite.MultiPair(p1s, p2s), ctx.MultiPair(gt, p1s, p2s))
+		require.False(t, ctx.PairingCheck(p1s, p2s))
+
+		p1s = []kyber.Point{p1, suite.G1().Point().Neg(p1)}
+		p2s = []kyber.Point{prep, p2}
+		require.True(t, ctx.PairingCheck(p1s, p2s))
+	}
+}
+
+func TestPairingAllocs(t *testing.T) {
+	suite := NewSuite()
+	ctx := NewPairingContext()
+	p1 := suite.G1().Point().Pick(random.New())
+	p2 := suite.G2().Point().Pick(random.New())
+	prep := NewPreparedG2(p2)
+	p1s := []kyber.Point{p1, suite.G1().Point().Neg(p1)}
+	p2s := []kyber.Point{prep, p2}
+	gt := suite.GT().Point()
+
+	allocs := map[string]func(){
+		"PairingContext.Pair":         func() { ctx.Pair(gt, p1, p2) },
+		"PairingContext.MultiPair":    func() { ctx.MultiPair(gt, p1s, p2s) },
+		"PairingContext.PairingCheck": func() { ctx.PairingCheck(p1s, p2s) },
+		"GT.Pair":                     func() { gt.(*pointGT).Pair(p1, p2) },
+		"GT.MultiPair":                func() { gt.(*pointGT).MultiPair(p1s, p2s) },
+		"GT.Finalize":                 func() { gt.(*pointGT).Finalize() },
+		"Suite.PairingCheck":          func() { suite.PairingCheck(p1s, p2s) },
+	}
+	for name, f := range allocs {
+		if n := testing.AllocsPerRun(10, f); n != 0 {
+			t.Errorf("%s allocates %v times", name, n)
+		}
+	}
+}
+
+func TestMulBaseAllocs(t *testing.T) {
+	suite := NewSuite()
+	for _, g := range []kyber.Group{suite.G1(), suite.G2()} {
+		s := g.Scalar().Pick(random.New())
+		p, base := g.Point(), g.Point().Base()
+		f := func() { p.Mul(s, nil) }
+		if n := testing.AllocsPerRun(10, f); n != 0 {
+			t.Errorf("%s: Mul of the base allocates %v times", g, n)
+		}
+		f = func() { p.Mul(s, base) }
+		if n := testing.AllocsPerRun(10, f); n != 0 {
+			t.Errorf("%s: Mul of Base() allocates %v times", g, n)
+		}
+	}
+}
+
+func TestBatchMarshal(t *testing.T) {
+	suite := NewSuite()
+	for _, g := range []kyber.Group{suite.G1(), suite.G2()} {
+		points := []kyber.Point{g.Point().Null(), g.Point().Base()}
+		for i := 0; i < 5; i++ {
+			p := g.Point().Pick(random.New())
+			points = append(points, p, g.Point().Add(p, points[1]))
+		}
+		points = append(points, g.Point().Null())
+
+		bufs, err := g.(interface {
+			BatchMarshal([]kyber.Point) ([][]byte, error)
+		}).BatchMarshal(points)
+		require.Nil(t, err)
+		require.Equal(t, len(points), len(bufs))
+		for i, p := range points {
+			want, err := p.MarshalBinary()
+			require.Nil(t, err)
+			require.Equal(t, want, bufs[i], "%s point %d", g, i)
+		}
+	}
+}
+
+func TestHashBatch(t *testing.T) {
+	for _, suite := range []*Suite{NewSuite(), NewSuiteCompressed()} {
+		g := suite.G1()
+		msgs := [][]byte{nil, []byte("a"), []byte("b")}
+		for i := 0; i < 20; i++ {
+			msgs = append(msgs, []byte(fmt.Sprintf("message %d", i)))
+		}
+		points := g.(interface {
+			HashBatch([][]byte) []kyber.Point
+		}).HashBatch(msgs)
+		require.Len(t, points, len(msgs))
+		for i, m := range msgs {
+			want := g.Point().(*pointG1).Hash(m)
+			require.True(t, want.Equal(points[i]), "message %d", i)
+			buf, err := want.MarshalBinary()
+			require.NoError(t, err)
+			got, err := points[i].MarshalBinary()
+			require.NoError(t, err)
+			require.Equal(t, buf, got)
+		}
+	}
+}
+
+func TestG2UnmarshalSubgroup(t *testing.T) {
+	c := randomTwistPoint()
+	buf := make([]byte, newPointG2().MarshalSize())
+	marshalTwistAffine(buf, newPointG2().ElementSize(), c)
+	require.Error(t, newPointG2().UnmarshalBinary(buf))
+
+	// Reusing a point for unmarshaling must not depend on its value.
+	suite := NewSuite()
+	q := suite.G2().Point().Pick(random.New())
+	qBuf, err := q.MarshalBinary()
+	require.NoError(t, err)
+	p := suite.G2().Point().Pick(random.New())
+	require.NoError(t, p.UnmarshalBinary(qBuf))
+	require.True(t, p.Equal(q))
+}
+
+func TestPointCache(t *testing.T) {
+	suite := NewSuite()
+	for _, g := range []kyber.Group{suite.G1(), suite.G2()} {
+		cache := NewPointCache(g, 2)
+		points := make([]kyber.Point, 3)
+		bufs := make([][]byte, 3)
+		for i := range points {
+			points[i] = g.Point().Pick(random.New())
+			buf, err := points[i].MarshalBinary()
+			require.NoError(t, err)
+			bufs[i] = buf
+		}
+
+		for _, i := range []int{0, 1, 0, 2, 1} {
+			p := g.Point()
+			require.NoError(t, cache.UnmarshalBinary(p, bufs[i]))
+			require.True(t, p.Equal(points[i]))
+		}
+		require.Equal(t, 2, cache.Len())
+
+		// Invalid points are not cached.
+		bad := append([]byte{}, bufs[0]...)
+		bad[len(bad)-1] ^= 1
+		require.Error(t, cache.UnmarshalBinary(g.Point(), bad))
+		require.Error(t, cache.UnmarshalBinary(g.Point(), bufs[0][:1]))
+		require.Equal(t, 2, cache.Len())
+	}
+}
+
+func TestCompressed(t *testing.T) {
+	suite := NewSuiteCompressed()
+	plain := NewSuite()
+	require.Equal(t, 33, suite.G1().PointLen())
+	require.Equal(t, 65, suite.G2().PointLen())
+	require.Equal(t, "bn256.c1", fmt.Sprintf("%s", suite.G1().Point().(*pointG1).MarshalID()))
+	require.Equal(t, "bn256.c2", fmt.Sprintf("%s", suite.G2().Point().(*pointG2).MarshalID()))
+
+	for _, g := range []kyber.Group{suite.G1(), suite.G2()} {
+		points := []kyber.Point{g.Point().Null(), g.Point().Base()}
+		for i := 0; i < 20; i++ {
+			points = append(points, g.Point().Pick(random.New()))
+		}
+		for _, p := range points {
+			buf, err := p.MarshalBinary()
+			require.NoError(t, err)
+			require.Len(t, buf, g.PointLen())
+
+			q := g.Point()
+			require.NoError(t, q.UnmarshalBinary(buf))
+			require.True(t, q.Equal(p))
+			require.True(t, p.Clone().Equal(p))
+		}
+
+		bufs, err := g.(interface {
+			BatchMarshal([]kyber.Point) ([][]byte, error)
+		}).BatchMarshal(points)
+		require.NoError(t, err)
+		for i, p := range points {
+			buf, _ := p.MarshalBinary()
+			require.Equal(t, buf, bufs[i])
+		}
+
+		// Prefixes other than 0x00, 0x02 and 0x03 are invalid, as are
+		// coordinates of at least p.
+		buf, _ := points[2].MarshalBinary()
+		buf[0] = 0x04
+		require.Error(t, g.Point().UnmarshalBinary(buf))
+		buf[0] = 0x02
+		for i := 1; i < len(buf); i++ {
+			buf[i] = 0xff
+		}
+		require.Error(t, g.Point().UnmarshalBinary(buf))
+	}
+
+	// Compressed and uncompressed points are the same points.
+	p1 := suite.G1().Point().Pick(random.New())
+	require.True(t, plain.G1().Point().Set(p1).Equal(p1))
+	require.True(t, p1.Equal(plain.G1().Point().Set(p1)))
+	p2 := suite.G2().Point().Pick(random.New())
+	require.True(t, plain.G2().Point().Set(p2).Equal(p2))
+
+	// Points that are on the curve but not in G2 are rejected.
+	c := randomTwistPoint()
+	buf := make([]byte, suite.G2().PointLen())
+	marshalTwistCompressed(buf, 32, c)
+	require.Error(t, suite.G2().Point().UnmarshalBinary(buf))
+}
+
+func TestAppendBinary(t *testing.T) {
+	for _, suite := range []*Suite{NewSuite(), NewSuiteCompressed()} {
+		points := []kyber.Point{
+			suite.G1().Point().Null(),
+			suite.G1().Point().Pick(random.New()),
+			suite.G2().Point().Null(),
+			suite.G2().Point().Pick(random.New()),
+			suite.GT().Point().Pick(random.New()),
+		}
+		for _, p := range points {
+			want, err := p.MarshalBinary()
+			require.NoError(t, err)
+
+			// The encoding is appended to the prefix, and writes all its
+			// bytes even if the spare capacity is not zeroed.
+			prefix := []byte{1, 2, 3}
+			buf := make([]byte, len(prefix), 64+len(want))
+			copy(buf, prefix)
+			for i := len(prefix); i < cap(buf); i++ {
+				buf[:cap(buf)][i] = 0xff
+			}
+			got, err := p.(kyber.BinaryAppender).AppendBinary(buf)
+			require.NoError(t, err)
+			require.Equal(t, append(prefix, want...), got)
+
+			allocs := testing.AllocsPerRun(10, func() {
+				p.(kyber.BinaryAppender).AppendBinary(buf)
+			})
+			require.Equal(t, 0.0, allocs)
+		}
+	}
+}
+
+func TestSuiteReadWrite(t *testing.T) {
+	suite := NewSuite()
+	s := suite.G1().Scalar().Pick(random.New())
+	p1 := suite.G1().Point().Pick(random.New())
+	p2 := suite.G2().Point().Pick(random.New())
+	gt := suite.GT().Point().Pick(random.New())
+
+	var buf bytes.Buffer
+	require.NoError(t, suite.Write(&buf, s, p1, p2, gt))
+	require.Equal(t, s.MarshalSize()+p1.MarshalSize()+p2.MarshalSize()+gt.MarshalSize(), buf.Len())
+
+	s2 := suite.G1().Scalar()
+	q1, q2, qt := suite.G1().Point(), suite.G2().Point(), suite.GT().Point()
+	require.NoError(t, suite.Read(bytes.NewReader(buf.Bytes()), s2, q1, q2, qt))
+	require.True(t, s.Equal(s2))
+	require.True(t, p1.Equal(q1))
+	require.True(t, p2.Equal(q2))
+	require.True(t, gt.Equal(qt))
+
+	// A short input fails as a whole.
+	err := suite.Read(bytes.NewReader(buf.Bytes()[:buf.Len()-1]), s2, q1, q2, qt)
+	require.Error(t, err)
+}
+
 func TestTripartiteDiffieHellman(t *testing.T) {
 	suite := NewSuite()
 	a := suite.G1().Scalar().Pick(random.New())
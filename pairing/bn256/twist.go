@@ -69,6 +69,27 @@ func (c *twistPoint) IsInfinity() bool {
 	return c.z.IsZero()
 }
 
+// Equal returns whether c and b are the same point, see curvePoint.Equal.
+func (c *twistPoint) Equal(b *twistPoint) bool {
+	if inf1, inf2 := c.IsInfinity(), b.IsInfinity(); inf1 || inf2 {
+		return inf1 == inf2
+	}
+
+	zz1, zz2, l, r := &gfP2{}, &gfP2{}, &gfP2{}, &gfP2{}
+	zz1.Square(&c.z)
+	zz2.Square(&b.z)
+	l.Mul(&c.x, zz2)
+	r.Mul(&b.x, zz1)
+	if *l != *r {
+		return false
+	}
+	zz2.Mul(zz2, &b.z)
+	zz1.Mul(zz1, &c.z)
+	l.Mul(&c.y, zz2)
+	r.Mul(&b.y, zz1)
+	return *l == *r
+}
+
 func (c *twistPoint) Add(a, b *twistPoint) {
 	// For additional comments, see the same function in curve.go.
 
@@ -128,8 +149,64 @@ func (c *twistPoint) Add(a, b *twistPoint) {
 	c.z.Mul(t4, h)
 }
 
+// addAffine sets c = a+b for an affine b. For additional comments, see the
+// same function in curve.go.
+func (c *twistPoint) addAffine(a *twistPoint, b *twistAffine) {
+	if a.IsInfinity() {
+		c.x.Set(&b.x)
+		c.y.Set(&b.y)
+		c.z.SetOne()
+		c.t.SetOne()
+		return
+	}
+
+	// See http://hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/addition/madd-2007-bl.op3
+	z12 := (&gfP2{}).Square(&a.z)
+	u2 := (&gfP2{}).Mul(&b.x, z12)
+	t := (&gfP2{}).Mul(&a.z, z12)
+	s2 := (&gfP2{}).Mul(&b.y, t)
+
+	h := (&gfP2{}).Sub(u2, &a.x)
+	xEqual := h.IsZero()
+
+	hh := (&gfP2{}).Square(h)
+	t.Add(hh, hh)
+	i := (&gfP2{}).Add(t, t)
+	j := (&gfP2{}).Mul(h, i)
+
+	t.Sub(s2, &a.y)
+	yEqual := t.IsZero()
+	if xEqual && yEqual {
+		c.Double(a)
+		return
+	}
+	r := (&gfP2{}).Add(t, t)
+
+	v := (&gfP2{}).Mul(&a.x, i)
+
+	t.Add(&a.z, h)
+	z := (&gfP2{}).Square(t)
+	t.Sub(z, z12)
+	z.Sub(t, hh)
+
+	t4 := (&gfP2{}).Square(r)
+	t.Add(v, v)
+	t6 := (&gfP2{}).Sub(t4, j)
+	c.x.Sub(t6, t)
+
+	t4.Mul(&a.y, j)
+	t6.Add(t4, t4)
+	t.Sub(v, &c.x)
+	t4.Mul(r, t)
+	c.y.Sub(t4, t6)
+
+	c.z.Set(z)
+}
+
 func (c *twistPoint) Double(a *twistPoint) {
 	// See http://hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/doubling/dbl-2009-l.op3
+	// z = 2·y·z is computed first, so that c may alias a.
+	yz := (&gfP2{}).Mul(&a.y, &a.z)
 	A := (&gfP2{}).Square(&a.x)
 	B := (&gfP2{}).Square(&a.y)
 	C := (&gfP2{}).Square(B)
@@ -153,25 +230,268 @@ func (c *twistPoint) Double(a *twistPoint) {
 	t2.Mul(e, &c.y)
 	c.y.Sub(t2, t)
 
-	t.Mul(&a.y, &a.z)
-	c.z.Add(t, t)
+	c.z.Add(yz, yz)
 }
 
+// Mul sets c = scalar·a for a in G₂. It splits the scalar with the
+// endomorphism ψ and uses a regular recoding of the two halves, so that the
+// sequence of point operations and table accesses doesn't depend on the
+// scalar. The result is only correct for points of order Order, since ψ only
+// acts as multiplication by psiLambda on G₂.
 func (c *twistPoint) Mul(a *twistPoint, scalar *big.Int) {
+	k1, k2 := psiDecompose(scalar)
+
+	// tables[0] holds the odd multiples of a and tables[1] those of ψ(a). Both
+	// halves are non-negative.
+	var tables [2][mulTableSize]twistPoint
+	twistOddMultiples(&tables[0], a)
+	for i := range tables[1] {
+		tables[1][i].psi(&tables[0][i])
+	}
+
+	var digits [2][mulDigits]int8
+	var even [2]uint64
+	for j, k := range []*big.Int{k1, k2} {
+		// The recoding needs an odd scalar: add one to an even one and
+		// subtract the point again at the end.
+		h := newHalfScalar(k)
+		even[j] = -(^h[0] & 1)
+		h[0] |= 1
+		digits[j] = recodeRegular(h)
+	}
+
 	sum, t := &twistPoint{}, &twistPoint{}
+	sum.lookup(&tables[0], digits[0][mulDigits-1])
+	t.lookup(&tables[1], digits[1][mulDigits-1])
+	sum.Add(sum, t)
+
+	for i := mulDigits - 2; i >= 0; i-- {
+		for w := 0; w < mulWindow; w += 2 {
+			t.Double(sum)
+			sum.Double(t)
+		}
+		for j := range tables {
+			t.lookup(&tables[j], digits[j][i])
+			sum.Add(sum, t)
+		}
+	}
+
+	for j := range tables {
+		t.Neg(&tables[j][0])
+		t.Add(sum, t)
+		sum.condSet(t, even[j])
+	}
+
+	c.Set(sum)
+}
+
+// mulVartime sets c = scalar·a for a in G₂ like Mul, but in variable time.
+// Only use it on public scalars.
+func (c *twistPoint) mulVartime(a *twistPoint, scalar *big.Int) {
+	c.multiScalarMul([]*big.Int{scalar}, []*twistPoint{a})
+}
+
+// multiScalarMul sets c = Σ scalars[i]·points[i] for points in G₂, in
+// variable time. It splits every scalar with psiDecompose, and then uses
+// Straus' method for few halves and Pippenger's for many.
+func (c *twistPoint) multiScalarMul(scalars []*big.Int, points []*twistPoint) {
+	hs := make([]halfScalar, 2*len(scalars))
+	for i, k := range scalars {
+		k1, k2 := psiDecompose(k)
+		hs[2*i], hs[2*i+1] = newHalfScalar(k1), newHalfScalar(k2)
+	}
+
+	if len(hs) <= msmStrausMax {
+		tables := make([][mulTableSize]twistPoint, len(hs))
+		for i, a := range points {
+			twistOddMultiples(&tables[2*i], a)
+			for j := range tables[2*i+1] {
+				tables[2*i+1][j].psi(&tables[2*i][j])
+			}
+		}
+		c.straus(hs, tables)
+		return
+	}
 
-	for i := scalar.BitLen(); i >= 0; i-- {
+	ps := make([]twistPoint, len(hs))
+	for i, a := range points {
+		ps[2*i].Set(a)
+		ps[2*i+1].psi(a)
+	}
+	c.pippenger(hs, ps)
+}
+
+// straus sets c = Σ hs[i]·Pᵢ in variable time, given the odd multiples of
+// every Pᵢ in tables. For additional comments, see the same function in
+// curve.go.
+func (c *twistPoint) straus(hs []halfScalar, tables [][mulTableSize]twistPoint) {
+	naf := make([][]int8, len(hs))
+	n := 0
+	for i := range hs {
+		naf[i] = recodeWNAF(hs[i])
+		if len(naf[i]) > n {
+			n = len(naf[i])
+		}
+	}
+
+	sum, t := &twistPoint{}, &twistPoint{}
+	sum.SetInfinity()
+	for i := n - 1; i >= 0; i-- {
 		t.Double(sum)
-		if scalar.Bit(i) != 0 {
-			sum.Add(t, a)
-		} else {
+		sum.Set(t)
+		for j := range naf {
+			if i >= len(naf[j]) || naf[j][i] == 0 {
+				continue
+			}
+			d := naf[j][i]
+			if d > 0 {
+				sum.Add(sum, &tables[j][d/2])
+			} else {
+				t.Neg(&tables[j][-d/2])
+				sum.Add(sum, t)
+			}
+		}
+	}
+
+	c.Set(sum)
+}
+
+// pippenger sets c = Σ hs[i]·ps[i] in variable time with Pippenger's bucket
+// method. For additional comments, see the same function in curve.go.
+func (c *twistPoint) pippenger(hs []halfScalar, ps []twistPoint) {
+	w := pippengerWindow(len(hs))
+	digits := make([][]int32, len(hs))
+	for i := range hs {
+		digits[i] = recodeSigned(hs[i], w)
+	}
+
+	buckets := make([]twistPoint, 1<<(w-1))
+	sum, run, win, t := &twistPoint{}, &twistPoint{}, &twistPoint{}, &twistPoint{}
+	sum.SetInfinity()
+	for i := len(digits[0]) - 1; i >= 0; i-- {
+		for j := uint(0); j < w; j++ {
+			t.Double(sum)
 			sum.Set(t)
 		}
+
+		for b := range buckets {
+			buckets[b].SetInfinity()
+		}
+		for k := range digits {
+			if d := digits[k][i]; d > 0 {
+				buckets[d-1].Add(&buckets[d-1], &ps[k])
+			} else if d < 0 {
+				t.Neg(&ps[k])
+				buckets[-d-1].Add(&buckets[-d-1], t)
+			}
+		}
+
+		run.SetInfinity()
+		win.SetInfinity()
+		for b := len(buckets) - 1; b >= 0; b-- {
+			run.Add(run, &buckets[b])
+			win.Add(win, run)
+		}
+		sum.Add(sum, win)
 	}
 
 	c.Set(sum)
 }
 
+// twistOddMultiples sets table to the odd multiples a, 3a, ..., of a.
+func twistOddMultiples(table *[mulTableSize]twistPoint, a *twistPoint) {
+	a2 := &twistPoint{}
+	a2.Double(a)
+	table[0].Set(a)
+	for i := 1; i < mulTableSize; i++ {
+		table[i].Add(&table[i-1], a2)
+	}
+}
+
+// psi sets c = ψ(a), the twist of the Frobenius of the untwisted a, which is
+// psiLambda·a for a in G₂.
+func (c *twistPoint) psi(a *twistPoint) {
+	c.x.Conjugate(&a.x).Mul(&c.x, xiToPMinus1Over3)
+	c.y.Conjugate(&a.y).Mul(&c.y, xiToPMinus1Over2)
+	c.z.Conjugate(&a.z)
+	c.t.Conjugate(&a.t)
+}
+
+// psiLambdaNAF is the width-(mulWindow+1) non-adjacent form of psiLambda.
+var psiLambdaNAF = recodeWNAF(newHalfScalar(psiLambda))
+
+// IsInSubgroup returns whether the point c on the curve is in G₂. Since the
+// curve has a large cofactor, this is not implied by IsOnCurve. Instead of
+// checking that Order·c is the point at infinity, it checks ψ(c) =
+// psiLambda·c, which only holds on G₂ (see "Co-factor clearing and subgroup
+// membership testing on pairing-friendly curves", El Housni, Guillevic and
+// Piellard), and takes a 128-bit instead of a 254-bit multiplication. It
+// runs in variable time.
+func (c *twistPoint) IsInSubgroup() bool {
+	if c.IsInfinity() {
+		return true
+	}
+
+	// psiLambda·c with the plain wNAF, since Mul relies on c being in G₂.
+	var table [mulTableSize]twistPoint
+	twistOddMultiples(&table, c)
+	sum, t := &twistPoint{}, &twistPoint{}
+	sum.SetInfinity()
+	for i := len(psiLambdaNAF) - 1; i >= 0; i-- {
+		sum.Double(sum)
+		if d := psiLambdaNAF[i]; d > 0 {
+			sum.Add(sum, &table[d/2])
+		} else if d < 0 {
+			t.Neg(&table[-d/2])
+			sum.Add(sum, t)
+		}
+	}
+
+	// Compare with ψ(c) = (x', y', z', t') in Jacobian coordinates, which are
+	// the same point if x'·z² = x·z'² and y'·z³ = y·z'³.
+	p := &twistPoint{}
+	p.psi(c)
+	l, r := &gfP2{}, &gfP2{}
+	l.Square(&sum.z)
+	r.Square(&p.z)
+	zz1, zz2 := *l, *r
+	l.Mul(l, &p.x)
+	r.Mul(r, &sum.x)
+	if *l != *r {
+		return false
+	}
+	l.Mul(&zz1, &sum.z).Mul(l, &p.y)
+	r.Mul(&zz2, &p.z).Mul(r, &sum.y)
+	return *l == *r
+}
+
+// lookup sets c to d·P, given the odd multiples of P in table and the odd
+// digit d, without a memory access pattern that depends on d.
+func (c *twistPoint) lookup(table *[mulTableSize]twistPoint, d int8) {
+	neg, idx := ctAbsIndex(d)
+
+	for i := range table {
+		c.condSet(&table[i], ctEq(i, idx))
+	}
+	ny := &gfP2{}
+	ny.Neg(&c.y)
+	gfpCMov(&c.y.x, &ny.x, neg)
+	gfpCMov(&c.y.y, &ny.y, neg)
+}
+
+// condSet sets c to a if mask is all ones, and leaves it unchanged if mask is
+// zero.
+func (c *twistPoint) condSet(a *twistPoint, mask uint64) {
+	gfpCMov(&c.x.x, &a.x.x, mask)
+	gfpCMov(&c.x.y, &a.x.y, mask)
+	gfpCMov(&c.y.x, &a.y.x, mask)
+	gfpCMov(&c.y.y, &a.y.y, mask)
+	gfpCMov(&c.z.x, &a.z.x, mask)
+	gfpCMov(&c.z.y, &a.z.y, mask)
+	gfpCMov(&c.t.x, &a.t.x, mask)
+	gfpCMov(&c.t.y, &a.t.y, mask)
+}
+
 func (c *twistPoint) MakeAffine() {
 	if c.z.IsOne() {
 		return
@@ -192,6 +512,45 @@ func (c *twistPoint) MakeAffine() {
 	c.t.SetOne()
 }
 
+// twistBatchMakeAffine converts all points to affine form like MakeAffine,
+// but with a single inversion. For additional comments, see the same
+// function in curve.go.
+func twistBatchMakeAffine(ps []*twistPoint) {
+	prods := make([]gfP2, len(ps))
+	acc := (&gfP2{}).SetOne()
+	for i, c := range ps {
+		if !c.IsInfinity() && !c.z.IsOne() {
+			acc.Mul(acc, &c.z)
+		}
+		prods[i] = *acc
+	}
+
+	inv := (&gfP2{}).Invert(acc)
+
+	zInv, zInv2, t := &gfP2{}, &gfP2{}, &gfP2{}
+	for i := len(ps) - 1; i >= 0; i-- {
+		c := ps[i]
+		if c.IsInfinity() || c.z.IsOne() {
+			c.MakeAffine()
+			continue
+		}
+
+		if i > 0 {
+			zInv.Mul(inv, &prods[i-1])
+		} else {
+			zInv.Set(inv)
+		}
+		inv.Mul(inv, &c.z)
+
+		zInv2.Square(zInv)
+		t.Mul(&c.y, zInv)
+		c.x.Mul(&c.x, zInv2)
+		c.y.Mul(t, zInv2)
+		c.z.SetOne()
+		c.t.SetOne()
+	}
+}
+
 func (c *twistPoint) Neg(a *twistPoint) {
 	c.x.Set(&a.x)
 	c.y.Neg(&a.y)
@@ -10,8 +10,26 @@ type Suite interface {
 	G2() kyber.Group
 	GT() kyber.Group
 	Pair(p1, p2 kyber.Point) kyber.Point
+	// MultiPair computes the product of the pairings of p1s[i] and p2s[i].
+	MultiPair(p1s, p2s []kyber.Point) kyber.Point
+	// PairingCheck returns whether the product of the pairings of p1s[i]
+	// and p2s[i] is the identity of GT.
+	PairingCheck(p1s, p2s []kyber.Point) bool
 	kyber.Encoding
 	kyber.HashFactory
 	kyber.XOFFactory
 	kyber.Random
 }
+
+// MillerLooper is an optional interface of GT points that can compute the
+// Miller loops of a multi-pairing separately from its final exponentiation.
+// The results of MultiMiller can be multiplied with Add, and Finalize turns
+// the product into the product of the pairings.
+type MillerLooper interface {
+	// MultiMiller sets the point to the product of the Miller loops of
+	// p1s[i] and p2s[i], and returns it.
+	MultiMiller(p1s, p2s []kyber.Point) kyber.Point
+	// Finalize applies the final exponentiation to the point, and returns
+	// it.
+	Finalize() kyber.Point
+}
@@ -7,6 +7,7 @@ package dleq
 
 import (
 	"errors"
+	"hash"
 
 	"go.dedis.ch/kyber/v3"
 )
@@ -51,8 +52,7 @@ func NewDLEQProof(suite Suite, G kyber.Point, H kyber.Point, x kyber.Scalar) (pr
 	xH.MarshalTo(h)
 	vG.MarshalTo(h)
 	vH.MarshalTo(h)
-	cb := h.Sum(nil)
-	c := suite.Scalar().Pick(suite.XOF(cb))
+	c := challenge(suite, h)
 
 	// Response
 	r := suite.Scalar()
@@ -102,9 +102,7 @@ func NewDLEQProofBatch(suite Suite, G []kyber.Point, H []kyber.Point, secrets []
 	for _, x := range vH {
 		x.MarshalTo(h)
 	}
-	cb := h.Sum(nil)
-
-	c := suite.Scalar().Pick(suite.XOF(cb))
+	c := challenge(suite, h)
 
 	// Responses
 	for i, x := range secrets {
@@ -116,6 +114,20 @@ func NewDLEQProofBatch(suite Suite, G []kyber.Point, H []kyber.Point, secrets []
 	return proofs, xG, xH, nil
 }
 
+// challenge derives the challenge from what was written to h. It gives h and
+// the XOF it uses back to the suite if it reuses them.
+func challenge(suite Suite, h hash.Hash) kyber.Scalar {
+	xof := suite.XOF(h.Sum(nil))
+	c := suite.Scalar().Pick(xof)
+	if p, ok := suite.(kyber.XOFPool); ok {
+		p.PutXOF(xof)
+	}
+	if p, ok := suite.(kyber.HashPool); ok {
+		p.PutHash(h)
+	}
+	return c
+}
+
 // Verify examines the validity of the NIZK dlog-equality proof.
 // The proof is valid if the following two conditions hold:
 //   vG == rG + c(xG)
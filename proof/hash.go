@@ -25,9 +25,10 @@ type cipherStreamReader struct {
 }
 
 func (s *cipherStreamReader) Read(in []byte) (int, error) {
-	x := make([]byte, len(in))
-	s.XORKeyStream(x, x)
-	copy(in, x)
+	for i := range in {
+		in[i] = 0
+	}
+	s.XORKeyStream(in, in)
 	return len(in), nil
 }
 
@@ -135,6 +136,7 @@ func (c *hashVerifier) PubRand(data ...interface{}) error {
 // deterministically reproducible proofs.
 func HashProve(suite Suite, protocolName string, prover Prover) ([]byte, error) {
 	ctx := newHashProver(suite, protocolName)
+	defer putXOF(suite, ctx.pubrand)
 	if e := (func(ProverContext) error)(prover)(ctx); e != nil {
 		return nil, e
 	}
@@ -150,5 +152,14 @@ func HashVerify(suite Suite, protocolName string,
 	if err != nil {
 		return err
 	}
+	defer putXOF(suite, ctx.pubrand)
 	return (func(VerifierContext) error)(verifier)(ctx)
 }
+
+// putXOF gives x back to the suite once a proof is done with it, if the suite
+// reuses its XOFs.
+func putXOF(suite Suite, x kyber.XOF) {
+	if p, ok := suite.(kyber.XOFPool); ok {
+		p.PutXOF(x)
+	}
+}
@@ -15,9 +15,13 @@ import (
 	"encoding/binary"
 	"errors"
 	"fmt"
+	"runtime"
 	"strings"
+	"sync"
 
 	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/msm"
+	"go.dedis.ch/kyber/v3/util/random"
 )
 
 // Some error definitions
@@ -177,73 +181,44 @@ func (p *PriPoly) Coefficients() []kyber.Scalar {
 // RecoverSecret reconstructs the shared secret p(0) from a list of private
 // shares using Lagrange interpolation.
 func RecoverSecret(g kyber.Group, shares []*PriShare, t, n int) (kyber.Scalar, error) {
-	x, y := xyScalar(g, shares, t, n)
-	if len(x) < t {
+	idx, y := xyScalar(shares, t, n)
+	if len(idx) < t {
 		return nil, errors.New("share: not enough shares to recover secret")
 	}
 
 	acc := g.Scalar().Zero()
-	num := g.Scalar()
-	den := g.Scalar()
-	tmp := g.Scalar()
-
-	for i, xi := range x {
-		yi := y[i]
-		num.Set(yi)
-		den.One()
-		for j, xj := range x {
-			if i == j {
-				continue
-			}
-			num.Mul(num, xj)
-			den.Mul(den, tmp.Sub(xj, xi))
-		}
-		acc.Add(acc, num.Div(num, den))
+	for i, c := range lagrangeCoefficients(g, idx) {
+		acc.Add(acc, c.Mul(c, y[i]))
 	}
-
 	return acc, nil
 }
 
-// xyScalar returns the list of (x_i, y_i) pairs indexed. The first map returned
-// is the list of x_i and the second map is the list of y_i, both indexed in
-// their respective map at index i.
-func xyScalar(g kyber.Group, shares []*PriShare, t, n int) (map[int]kyber.Scalar, map[int]kyber.Scalar) {
+// xyScalar returns the indices and the values of the first t valid shares
+// in the order of their indices.
+func xyScalar(shares []*PriShare, t, n int) ([]int, []kyber.Scalar) {
 	// we are sorting first the shares since the shares may be unrelated for
 	// some applications. In this case, all participants needs to interpolate on
 	// the exact same order shares.
-	// XXX naive n^2 sorting => move that to inplace golang native sort
 	sorted := make([]*PriShare, n)
-	for i := 0; i < len(shares); i++ {
-		if shares[i] != nil {
-			sorted[shares[i].I] = shares[i]
+	for _, s := range shares {
+		if s != nil && s.V != nil && 0 <= s.I && s.I < n {
+			sorted[s.I] = s
 		}
 	}
-	if len(sorted) < len(shares) {
-		panic("that should not happen")
-	}
 
-	x := make(map[int]kyber.Scalar)
-	y := make(map[int]kyber.Scalar)
+	idx := make([]int, 0, t)
+	y := make([]kyber.Scalar, 0, t)
 	for _, s := range sorted {
-		if s == nil || s.V == nil || s.I < 0 || n <= s.I {
+		if s == nil {
 			continue
 		}
-		idx := s.I
-		x[idx] = g.Scalar().SetInt64(int64(idx + 1))
-		y[idx] = s.V
-		if len(x) == t {
+		idx = append(idx, s.I)
+		y = append(y, s.V)
+		if len(idx) == t {
 			break
 		}
 	}
-	return x, y
-}
-
-func minusConst(g kyber.Group, c kyber.Scalar) *PriPoly {
-	neg := g.Scalar().Neg(c)
-	return &PriPoly{
-		g:      g,
-		coeffs: []kyber.Scalar{neg, g.Scalar().One()},
-	}
+	return idx, y
 }
 
 // RecoverPriPoly takes a list of shares and the parameters t and n to
@@ -252,34 +227,25 @@ func minusConst(g kyber.Group, c kyber.Scalar) *PriPoly {
 // shares to correctly re-construct the polynomial. There must be at least t
 // shares.
 func RecoverPriPoly(g kyber.Group, shares []*PriShare, t, n int) (*PriPoly, error) {
-	x, y := xyScalar(g, shares, t, n)
-	if len(x) != t {
+	idx, y := xyScalar(shares, t, n)
+	if len(idx) != t {
 		return nil, errors.New("share: not enough shares to recover private polynomial")
 	}
 
-	var accPoly *PriPoly
-	var err error
-	//den := g.Scalar()
 	// Notations follow the Wikipedia article on Lagrange interpolation
 	// https://en.wikipedia.org/wiki/Lagrange_polynomial
-	for j := range x {
-		basis := lagrangeBasis(g, j, x)
-		for i := range basis.coeffs {
-			basis.coeffs[i] = basis.coeffs[i].Mul(basis.coeffs[i], y[j])
-		}
-
-		if accPoly == nil {
-			accPoly = basis
-			continue
-		}
-
-		// add all L_j * y_j together
-		accPoly, err = accPoly.Add(basis)
-		if err != nil {
-			return nil, err
+	// The polynomial is the sum of the y_j·L_j.
+	coeffs := make([]kyber.Scalar, t)
+	for i := range coeffs {
+		coeffs[i] = g.Scalar().Zero()
+	}
+	tmp := g.Scalar()
+	for j, basis := range lagrangeBases(g, idx) {
+		for i, c := range basis {
+			coeffs[i].Add(coeffs[i], tmp.Mul(c, y[j]))
 		}
 	}
-	return accPoly, nil
+	return &PriPoly{g: g, coeffs: coeffs}, nil
 }
 
 func (p *PriPoly) String() string {
@@ -333,21 +299,54 @@ func (p *PubPoly) Commit() kyber.Point {
 
 // Eval computes the public share v = p(i).
 func (p *PubPoly) Eval(i int) *PubShare {
-	xi := p.g.Scalar().SetInt64(1 + int64(i)) // x-coordinate of this share
-	v := p.g.Point().Null()
-	for j := p.Threshold() - 1; j >= 0; j-- {
-		v.Mul(xi, v)
-		v.Add(v, p.commits[j])
-	}
+	v := msm.MultiScalarMul(p.g, p.powers(i), p.commits)
 	return &PubShare{i, v}
 }
 
-// Shares creates a list of n public commitment shares p(1),...,p(n).
+// powers returns the powers xi^0, ..., xi^(t-1) of the x-coordinate xi = i+1
+// of share i, which weigh the commitments in p(i).
+func (p *PubPoly) powers(i int) []kyber.Scalar {
+	xi := p.g.Scalar().SetInt64(1 + int64(i))
+	pows := make([]kyber.Scalar, p.Threshold())
+	xj := p.g.Scalar().One()
+	for j := range pows {
+		pows[j] = xj.Clone()
+		xj.Mul(xj, xi)
+	}
+	return pows
+}
+
+// Shares creates a list of n public commitment shares p(1),...,p(n). The
+// shares are evaluated concurrently on up to GOMAXPROCS goroutines.
 func (p *PubPoly) Shares(n int) []*PubShare {
 	shares := make([]*PubShare, n)
-	for i := range shares {
-		shares[i] = p.Eval(i)
+	workers := runtime.GOMAXPROCS(0)
+	if workers > n {
+		workers = n
+	}
+	if workers <= 1 {
+		for i := range shares {
+			shares[i] = p.Eval(i)
+		}
+		return shares
 	}
+
+	var wg sync.WaitGroup
+	chunk := (n + workers - 1) / workers
+	for lo := 0; lo < n; lo += chunk {
+		hi := lo + chunk
+		if hi > n {
+			hi = n
+		}
+		wg.Add(1)
+		go func(lo, hi int) {
+			defer wg.Done()
+			for i := lo; i < hi; i++ {
+				shares[i] = p.Eval(i)
+			}
+		}(lo, hi)
+	}
+	wg.Wait()
 	return shares
 }
 
@@ -391,133 +390,320 @@ func (p *PubPoly) Equal(q *PubPoly) bool {
 	return b == 1
 }
 
-// Check a private share against a public commitment polynomial.
+// Check a private share against a public commitment polynomial. It checks
+// that p(i) == v·b, where p(i) is computed from the public commitments with
+// one multi-scalar multiplication, and v·b, which depends on the secret share,
+// with a constant-time Mul.
 func (p *PubPoly) Check(s *PriShare) bool {
-	pv := p.Eval(s.I)
-	ps := p.g.Point().Mul(s.V, p.b)
-	return pv.V.Equal(ps)
+	pv := msm.MultiScalarMul(p.g, p.powers(s.I), p.commits)
+	return pv.Equal(p.g.Point().Mul(s.V, p.b))
+}
+
+// BatchCheck checks the private shares shares[k] against the public
+// commitment polynomials polys[k], which must be of the same group, at once.
+// Each equation p_k(i_k) == v_k·b_k is weighted with a random 128-bit scalar
+// r_k, and Σ r_k·p_k(i_k) == Σ r_k·v_k·b_k is checked. The left side only
+// depends on public values and is one multi-scalar multiplication. The right
+// side depends on the secret shares: its terms of equal base points are
+// merged, and each base point is multiplied with a constant-time Mul. In a
+// group of prime order, an invalid share makes the check fail except with
+// probability 2^-128. In a group with small subgroups, such as
+// edwards25519, a share whose commitments differ from valid ones by points of
+// small order may pass where Check fails.
+//
+// BatchCheck returns -1 and nil if all shares are valid. Otherwise, it finds
+// an invalid share by checking halves of the failed batch, and returns its
+// index and an error.
+func BatchCheck(polys []*PubPoly, shares []*PriShare) (int, error) {
+	n := len(shares)
+	if len(polys) != n {
+		return -1, fmt.Errorf("share: got %d polynomials for %d shares", len(polys), n)
+	}
+	if n == 0 {
+		return -1, nil
+	}
+	g := polys[0].g
+
+	// bases holds the distinct base points, and share k is checked against
+	// bases[base[k]]. rvs[k] is r_k·v_k and rpows[k] the powers of the
+	// x-coordinate of share k times r_k.
+	var bases []kyber.Point
+	base := make([]int, n)
+	rvs := make([]kyber.Scalar, n)
+	rpows := make([][]kyber.Scalar, n)
+	stream := random.New()
+	for k, p := range polys {
+		base[k] = -1
+		for j, b := range bases {
+			if b == p.b || b != nil && p.b != nil && b.Equal(p.b) {
+				base[k] = j
+				break
+			}
+		}
+		if base[k] < 0 {
+			base[k] = len(bases)
+			bases = append(bases, p.b)
+		}
+
+		r := g.Scalar().SetBytes(random.Bits(128, false, stream))
+		rvs[k] = g.Scalar().Mul(r, shares[k].V)
+		rpows[k] = p.powers(shares[k].I)
+		for _, x := range rpows[k] {
+			x.Mul(x, r)
+		}
+	}
+
+	check := func(lo, hi int) bool {
+		var scalars []kyber.Scalar
+		var points []kyber.Point
+		sums := make([]kyber.Scalar, len(bases))
+		for k := lo; k < hi; k++ {
+			scalars = append(scalars, rpows[k]...)
+			points = append(points, polys[k].commits...)
+			if sums[base[k]] == nil {
+				sums[base[k]] = g.Scalar().Zero()
+			}
+			sums[base[k]].Add(sums[base[k]], rvs[k])
+		}
+		rhs := g.Point().Null()
+		for j, sum := range sums {
+			if sum != nil {
+				rhs.Add(rhs, g.Point().Mul(sum, bases[j]))
+			}
+		}
+		return msm.MultiScalarMul(g, scalars, points).Equal(rhs)
+	}
+	if check(0, n) {
+		return -1, nil
+	}
+
+	// Bisect the failed batch [lo, hi): if its first half passes, the
+	// second one fails.
+	lo, hi := 0, n
+	for hi-lo > 1 {
+		mid := (lo + hi) / 2
+		if check(lo, mid) {
+			lo = mid
+		} else {
+			hi = mid
+		}
+	}
+	return lo, fmt.Errorf("share: invalid share %d", shares[lo].I)
 }
 
-// xyCommits is the public version of xScalars.
-func xyCommit(g kyber.Group, shares []*PubShare, t, n int) (map[int]kyber.Scalar, map[int]kyber.Point) {
+// xyCommit is the public version of xyScalar.
+func xyCommit(shares []*PubShare, t, n int) ([]int, []kyber.Point) {
 	// we are sorting first the shares since the shares may be unrelated for
 	// some applications. In this case, all participants needs to interpolate on
 	// the exact same order shares.
-	// XXX naive n^2 sorting => move that to inplace golang native sort
 	sorted := make([]*PubShare, n)
-	for i := 0; i < len(shares); i++ {
-		if shares[i] != nil {
-			sorted[shares[i].I] = shares[i]
+	for _, s := range shares {
+		if s != nil && s.V != nil && 0 <= s.I && s.I < n {
+			sorted[s.I] = s
 		}
 	}
 
-	if len(sorted) < len(shares) {
-		panic("that should not happen")
-	}
-	x := make(map[int]kyber.Scalar)
-	y := make(map[int]kyber.Point)
-
+	idx := make([]int, 0, t)
+	y := make([]kyber.Point, 0, t)
 	for _, s := range sorted {
-		if s == nil || s.V == nil || s.I < 0 || n <= s.I {
+		if s == nil {
 			continue
 		}
-		idx := s.I
-		x[idx] = g.Scalar().SetInt64(int64(idx + 1))
-		y[idx] = s.V
-		if len(x) == t {
+		idx = append(idx, s.I)
+		y = append(y, s.V)
+		if len(idx) == t {
 			break
 		}
 	}
-	return x, y
+	return idx, y
 }
 
 // RecoverCommit reconstructs the secret commitment p(0) from a list of public
 // shares using Lagrange interpolation.
 func RecoverCommit(g kyber.Group, shares []*PubShare, t, n int) (kyber.Point, error) {
-	x, y := xyCommit(g, shares, t, n)
-	if len(x) < t {
+	idx, y := xyCommit(shares, t, n)
+	if len(idx) < t {
 		return nil, errors.New("share: not enough good public shares to reconstruct secret commitment")
 	}
-
-	num := g.Scalar()
-	den := g.Scalar()
-	tmp := g.Scalar()
-	Acc := g.Point().Null()
-	Tmp := g.Point()
-
-	for i, xi := range x {
-		num.One()
-		den.One()
-		for j, xj := range x {
-			if i == j {
-				continue
-			}
-			num.Mul(num, xj)
-			den.Mul(den, tmp.Sub(xj, xi))
-		}
-		Tmp.Mul(num.Div(num, den), y[i])
-		Acc.Add(Acc, Tmp)
-	}
-
-	return Acc, nil
+	return msm.MultiScalarMul(g, lagrangeCoefficients(g, idx), y), nil
 }
 
 // RecoverPubPoly reconstructs the full public polynomial from a set of public
 // shares using Lagrange interpolation.
 func RecoverPubPoly(g kyber.Group, shares []*PubShare, t, n int) (*PubPoly, error) {
-	x, y := xyCommit(g, shares, t, n)
-	if len(x) < t {
+	idx, y := xyCommit(shares, t, n)
+	if len(idx) < t {
 		return nil, errors.New("share: not enough good public shares to reconstruct secret commitment")
 	}
 
-	var accPoly *PubPoly
-	var err error
+	// The k-th commitment is the sum of the y_j times the k-th coefficients
+	// of the L_j.
+	bases := lagrangeBases(g, idx)
+	commits := make([]kyber.Point, t)
+	scalars := make([]kyber.Scalar, t)
+	for k := range commits {
+		for j, basis := range bases {
+			scalars[j] = basis[k]
+		}
+		commits[k] = msm.MultiScalarMul(g, scalars, y)
+	}
+	return &PubPoly{g: g, b: g.Point().Base(), commits: commits}, nil
+}
 
-	for j := range x {
-		basis := lagrangeBasis(g, j, x)
+// lagrangeCoefficients returns the Lagrange coefficients at 0 of the
+// indices idx, which are sorted and distinct: the λ_i with
+// p(0) = λ_0·p(x_0) + ... for x_i = idx[i]+1 and any polynomial p of degree
+// below len(idx), that is λ_i = Π x_j / (x_j - x_i) over the j ≠ i.
+func lagrangeCoefficients(g kyber.Group, idx []int) []kyber.Scalar {
+	coeffs := make([]kyber.Scalar, len(idx))
+	if len(idx) == 0 {
+		return coeffs
+	}
 
-		// compute the L_j * y_j polynomial in point space
-		tmp := basis.Commit(y[j])
-		if accPoly == nil {
-			accPoly = tmp
-			continue
+	// The numerators from the products of the x_j before and after i.
+	acc := g.Scalar().One()
+	x := g.Scalar()
+	for i, id := range idx {
+		coeffs[i] = g.Scalar().Set(acc)
+		acc.Mul(acc, x.SetInt64(int64(id+1)))
+	}
+	acc.One()
+	for i := len(idx) - 1; i >= 0; i-- {
+		coeffs[i].Mul(coeffs[i], acc)
+		acc.Mul(acc, x.SetInt64(int64(idx[i]+1)))
+	}
+
+	for i, d := range lagrangeDenominators(g, idx) {
+		coeffs[i].Mul(coeffs[i], d)
+	}
+	return coeffs
+}
+
+// lagrangeDenominators returns the inverses of the Π (x_j - x_i) over the
+// j ≠ i for the sorted and distinct indices idx, with one inversion.
+func lagrangeDenominators(g kyber.Group, idx []int) []kyber.Scalar {
+	t := len(idx)
+	lo, hi := idx[0], idx[t-1]
+	dens := make([]kyber.Scalar, t)
+	tmp := g.Scalar()
+
+	if gaps := hi - lo + 1 - t; gaps < t {
+		// Over all the indices from lo to hi, the product for idx[i] is
+		// (-1)^(idx[i]-lo)·(idx[i]-lo)!·(hi-idx[i])!. Dividing out the
+		// missing indices takes fewer multiplications than the direct
+		// products if the indices are nearly contiguous.
+		missing := make([]int, 0, gaps)
+		for i, k := 0, lo; k <= hi; k++ {
+			if idx[i] == k {
+				i++
+			} else {
+				missing = append(missing, k)
+			}
 		}
+		invFact := inverseFactorials(g, hi-lo)
+		for i, id := range idx {
+			d := g.Scalar().Mul(invFact[id-lo], invFact[hi-id])
+			if (id-lo)%2 == 1 {
+				d.Neg(d)
+			}
+			for _, k := range missing {
+				d.Mul(d, tmp.SetInt64(int64(k-id)))
+			}
+			dens[i] = d
+		}
+		return dens
+	}
 
-		// add all L_j * y_j together
-		accPoly, err = accPoly.Add(tmp)
-		if err != nil {
-			return nil, err
+	for i, id := range idx {
+		d := g.Scalar().One()
+		for _, jd := range idx {
+			if jd != id {
+				d.Mul(d, tmp.SetInt64(int64(jd-id)))
+			}
 		}
+		dens[i] = d
 	}
+	batchInvert(g, dens)
+	return dens
+}
 
-	return accPoly, nil
+// inverseFactorials returns the inverses of 0!, ..., n!, with one inversion.
+func inverseFactorials(g kyber.Group, n int) []kyber.Scalar {
+	inv := make([]kyber.Scalar, n+1)
+	k := g.Scalar()
+	f := g.Scalar().One()
+	for i := 2; i <= n; i++ {
+		f.Mul(f, k.SetInt64(int64(i)))
+	}
+	inv[n] = f.Inv(f)
+	// 1/(i-1)! = i/i!
+	for i := n; i > 0; i-- {
+		inv[i-1] = g.Scalar().Mul(inv[i], k.SetInt64(int64(i)))
+	}
+	return inv
+}
 
+// batchInvert replaces the non-zero scalars s[i] with their inverses, with a
+// single inversion and 3(len(s)-1) multiplications (Montgomery's trick).
+func batchInvert(g kyber.Group, s []kyber.Scalar) {
+	if len(s) == 0 {
+		return
+	}
+	// prefix[i] = s[0]···s[i]
+	prefix := make([]kyber.Scalar, len(s))
+	prefix[0] = g.Scalar().Set(s[0])
+	for i := 1; i < len(s); i++ {
+		prefix[i] = g.Scalar().Mul(prefix[i-1], s[i])
+	}
+	inv := g.Scalar().Inv(prefix[len(s)-1])
+	tmp := g.Scalar()
+	for i := len(s) - 1; i > 0; i-- {
+		// 1/s[i] = s[0]···s[i-1] / (s[0]···s[i])
+		tmp.Mul(inv, prefix[i-1])
+		inv.Mul(inv, s[i])
+		s[i].Set(tmp)
+	}
+	s[0].Set(inv)
 }
 
-// lagrangeBasis returns a PriPoly containing the Lagrange coefficients for the
-// i-th position. xs is a mapping between the indices and the values that the
-// interpolation is using, computed with xyScalar().
-func lagrangeBasis(g kyber.Group, i int, xs map[int]kyber.Scalar) *PriPoly {
-	var basis = &PriPoly{
-		g:      g,
-		coeffs: []kyber.Scalar{g.Scalar().One()},
+// lagrangeBases returns the coefficients of the Lagrange basis polynomials
+// L_i of the x_i = idx[i]+1, for sorted and distinct indices idx, with
+// L_i(x_i) = 1 and L_i(x_j) = 0 for j ≠ i.
+func lagrangeBases(g kyber.Group, idx []int) [][]kyber.Scalar {
+	t := len(idx)
+	xs := make([]kyber.Scalar, t)
+	for i, id := range idx {
+		xs[i] = g.Scalar().SetInt64(int64(id + 1))
 	}
-	// compute lagrange basis l_j
-	den := g.Scalar().One()
-	var acc = g.Scalar().One()
-	for m, xm := range xs {
-		if i == m {
-			continue
+
+	// N(X) = Π (X - x_j), with the coefficient of X^k in N[k].
+	N := make([]kyber.Scalar, t+1)
+	N[0] = g.Scalar().One()
+	tmp := g.Scalar()
+	for j, xj := range xs {
+		N[j+1] = g.Scalar().Set(N[j])
+		for k := j; k > 0; k-- {
+			N[k].Sub(N[k-1], tmp.Mul(N[k], xj))
 		}
-		basis = basis.Mul(minusConst(g, xm))
-		den.Sub(xs[i], xm) // den = xi - xm
-		den.Inv(den)       // den = 1 / den
-		acc.Mul(acc, den)  // acc = acc * den
+		N[0].Mul(N[0], tmp.Neg(xj))
 	}
 
-	// multiply all coefficients by the denominator
-	for i := range basis.coeffs {
-		basis.coeffs[i] = basis.coeffs[i].Mul(basis.coeffs[i], acc)
+	// L_i = N(X) / (X - x_i) / Π (x_i - x_j) over the j ≠ i, where the
+	// quotient comes from synthetic division and the Π (x_i - x_j) are the
+	// denominators up to the sign (-1)^(t-1).
+	dens := lagrangeDenominators(g, idx)
+	bases := make([][]kyber.Scalar, t)
+	for i, xi := range xs {
+		if t%2 == 0 {
+			dens[i].Neg(dens[i])
+		}
+		basis := make([]kyber.Scalar, t)
+		q := g.Scalar().Set(N[t])
+		for k := t - 1; k >= 0; k-- {
+			basis[k] = g.Scalar().Mul(q, dens[i])
+			q.Add(N[k], q.Mul(q, xi))
+		}
+		bases[i] = basis
 	}
-	return basis
+	return bases
 }
@@ -1,6 +1,7 @@
 package share
 
 import (
+	"runtime"
 	"testing"
 
 	"github.com/stretchr/testify/assert"
@@ -105,6 +106,72 @@ func TestPublicCheck(test *testing.T) {
 	}
 }
 
+func TestPublicCheckInvalid(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	n, t := 10, 6
+	priPoly := NewPriPoly(g, t, nil, g.RandomStream())
+	pubPoly := priPoly.Commit(nil)
+
+	share := priPoly.Eval(3)
+	bad := &PriShare{I: share.I, V: g.Scalar().Add(share.V, g.Scalar().One())}
+	require.False(test, pubPoly.Check(bad))
+	require.False(test, pubPoly.Check(&PriShare{I: share.I, V: priPoly.Eval(n).V}))
+}
+
+func TestPubPolyShares(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	n, t := 13, 5
+	pubPoly := NewPriPoly(g, t, nil, g.RandomStream()).Commit(nil)
+
+	// Force several workers, even on a single CPU.
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(4))
+	shares := pubPoly.Shares(n)
+	require.Len(test, shares, n)
+	for i, s := range shares {
+		require.Equal(test, i, s.I)
+		require.True(test, pubPoly.Eval(i).V.Equal(s.V))
+	}
+}
+
+func TestBatchCheck(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	n, t := 10, 4
+	h := g.Point().Pick(g.RandomStream())
+
+	// Shares of several dealers, with the standard base or with h.
+	var polys []*PubPoly
+	var shares []*PriShare
+	for k := 0; k < n; k++ {
+		var b kyber.Point
+		if k%3 == 0 {
+			b = h
+		}
+		priPoly := NewPriPoly(g, t, nil, g.RandomStream())
+		polys = append(polys, priPoly.Commit(b))
+		shares = append(shares, priPoly.Eval(k))
+	}
+
+	i, err := BatchCheck(polys, shares)
+	require.NoError(test, err)
+	require.Equal(test, -1, i)
+
+	i, err = BatchCheck(nil, nil)
+	require.NoError(test, err)
+	require.Equal(test, -1, i)
+
+	for _, bad := range []int{0, 5, n - 1} {
+		good := shares[bad]
+		shares[bad] = &PriShare{I: good.I, V: g.Scalar().Add(good.V, g.Scalar().One())}
+		i, err = BatchCheck(polys, shares)
+		require.Error(test, err)
+		require.Equal(test, bad, i)
+		shares[bad] = good
+	}
+
+	_, err = BatchCheck(polys[1:], shares)
+	require.Error(test, err)
+}
+
 func TestPublicRecovery(test *testing.T) {
 	g := edwards25519.NewBlakeSHA256Ed25519()
 	n := 10
@@ -311,6 +378,121 @@ func TestRecoverPriPoly(test *testing.T) {
 	}
 }
 
+// TestLagrangeCoefficients checks the coefficients of contiguous, nearly
+// contiguous and sparse sets of indices against their definition.
+func TestLagrangeCoefficients(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	for _, idx := range [][]int{
+		{0},
+		{3, 4, 5, 6, 7},
+		{0, 1, 3, 4, 6, 7, 8},
+		{2, 40, 41, 99},
+	} {
+		coeffs := lagrangeCoefficients(g, idx)
+		tmp := g.Scalar()
+		for i, id := range idx {
+			want := g.Scalar().One()
+			xi := g.Scalar().SetInt64(int64(id + 1))
+			for _, jd := range idx {
+				if jd != id {
+					xj := g.Scalar().SetInt64(int64(jd + 1))
+					want.Mul(want, xj).Div(want, tmp.Sub(xj, xi))
+				}
+			}
+			require.True(test, want.Equal(coeffs[i]), "index %d of %v", id, idx)
+		}
+
+		// The bases take the value 1 at their own point and 0 at the
+		// others.
+		bases := lagrangeBases(g, idx)
+		for i, basis := range bases {
+			p := CoefficientsToPriPoly(g, basis)
+			for j, jd := range idx {
+				want := g.Scalar().Zero()
+				if i == j {
+					want.One()
+				}
+				require.True(test, want.Equal(p.Eval(jd).V), "basis %d at index %d of %v", i, jd, idx)
+			}
+		}
+	}
+}
+
+func TestBatchInvert(test *testing.T) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	s := make([]kyber.Scalar, 10)
+	want := make([]kyber.Scalar, len(s))
+	for i := range s {
+		s[i] = g.Scalar().Pick(g.RandomStream())
+		want[i] = g.Scalar().Inv(s[i])
+	}
+	batchInvert(g, s)
+	for i := range s {
+		require.True(test, want[i].Equal(s[i]))
+	}
+}
+
+func benchmarkRecover(b *testing.B, priv bool) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	n, t := 100, 67
+	poly := NewPriPoly(g, t, nil, g.RandomStream())
+	priShares := poly.Shares(n)
+	pubShares := poly.Commit(nil).Shares(n)
+	// Drop every third share but the first ones, so that the indices have
+	// gaps.
+	for i := 2; i < n; i += 3 {
+		priShares[i], pubShares[i] = nil, nil
+	}
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		var err error
+		if priv {
+			_, err = RecoverSecret(g, priShares, t, n)
+		} else {
+			_, err = RecoverCommit(g, pubShares, t, n)
+		}
+		if err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkRecoverSecret(b *testing.B) { benchmarkRecover(b, true) }
+func BenchmarkRecoverCommit(b *testing.B) { benchmarkRecover(b, false) }
+
+// benchmarkCheck checks the shares of one node in a DKG of n nodes with
+// threshold t, one by one or as a batch.
+func benchmarkCheck(b *testing.B, batch bool) {
+	g := edwards25519.NewBlakeSHA256Ed25519()
+	n, t := 64, 43
+	polys := make([]*PubPoly, n)
+	shares := make([]*PriShare, n)
+	for k := range polys {
+		priPoly := NewPriPoly(g, t, nil, g.RandomStream())
+		polys[k] = priPoly.Commit(nil)
+		shares[k] = priPoly.Eval(n / 2)
+	}
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if batch {
+			if _, err := BatchCheck(polys, shares); err != nil {
+				b.Fatal(err)
+			}
+			continue
+		}
+		for k, p := range polys {
+			if !p.Check(shares[k]) {
+				b.Fatal("invalid share")
+			}
+		}
+	}
+}
+
+func BenchmarkCheck(b *testing.B)      { benchmarkCheck(b, false) }
+func BenchmarkBatchCheck(b *testing.B) { benchmarkCheck(b, true) }
+
 func TestPriPolyCoefficients(test *testing.T) {
 	suite := edwards25519.NewBlakeSHA256Ed25519()
 	n := 10
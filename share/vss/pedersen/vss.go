@@ -578,13 +578,8 @@ func (a *Aggregator) VerifyDeal(d *Deal, inclusion bool) error {
 	if fi.I < 0 || fi.I >= len(a.verifiers) {
 		return errors.New("vss: index out of bounds in Deal")
 	}
-	// compute fi * G
-	fig := a.suite.Point().Base().Mul(fi.V, nil)
-
 	commitPoly := share.NewPubPoly(a.suite, nil, d.Commitments)
-
-	pubShare := commitPoly.Eval(fi.I)
-	if !fig.Equal(pubShare.V) {
+	if !commitPoly.Check(fi) {
 		return errors.New("vss: share does not verify against commitments in Deal")
 	}
 	return nil
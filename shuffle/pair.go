@@ -23,9 +23,12 @@ import (
 	"crypto/cipher"
 	"encoding/binary"
 	"errors"
+	"runtime"
+	"sync"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/proof"
+	"go.dedis.ch/kyber/v3/util/msm"
 	"go.dedis.ch/kyber/v3/util/random"
 )
 
@@ -86,6 +89,11 @@ type ega6 struct {
 // or alternatively the caller may simply invoke Shuffle()
 // to pick a random permutation, compute the shuffle,
 // and compute the correctness proof.
+//
+// A PairShuffle keeps the vectors of the proof and of the prover's secrets
+// between runs, so that repeated proofs and verifications of k-element
+// shuffles do not allocate them again. The per-element multiplications are
+// spread over GOMAXPROCS goroutines.
 type PairShuffle struct {
 	grp kyber.Group
 	k   int
@@ -95,6 +103,15 @@ type PairShuffle struct {
 	v4  ega4
 	p5  ega5
 	pv6 SimpleShuffle
+
+	// prover secrets, allocated by the first Prove
+	piinv         []int
+	u, w, a, b, r []kyber.Scalar
+	s             []kyber.Scalar
+
+	// verifier scratch, allocated by the first Verify
+	scalars []kyber.Scalar
+	points  []kyber.Point
 }
 
 // Init creates a new PairShuffleProof instance for a k-element ElGamal pair shuffle.
@@ -109,18 +126,68 @@ func (ps *PairShuffle) Init(grp kyber.Group, k int) *PairShuffle {
 	// Create a well-formed PairShuffleProof with arrays correctly sized.
 	ps.grp = grp
 	ps.k = k
-	ps.p1.A = make([]kyber.Point, k)
-	ps.p1.C = make([]kyber.Point, k)
-	ps.p1.U = make([]kyber.Point, k)
-	ps.p1.W = make([]kyber.Point, k)
-	ps.v2.Zrho = make([]kyber.Scalar, k)
-	ps.p3.D = make([]kyber.Point, k)
-	ps.p5.Zsigma = make([]kyber.Scalar, k)
+	ps.p1.Gamma = grp.Point()
+	ps.p1.A = newPoints(grp, k)
+	ps.p1.C = newPoints(grp, k)
+	ps.p1.U = newPoints(grp, k)
+	ps.p1.W = newPoints(grp, k)
+	ps.p1.Lambda1 = grp.Point()
+	ps.p1.Lambda2 = grp.Point()
+	ps.v2.Zrho = newScalars(grp, k)
+	ps.p3.D = newPoints(grp, k)
+	ps.p5.Zsigma = newScalars(grp, k)
 	ps.pv6.Init(grp, k)
 
+	ps.piinv, ps.scalars, ps.points = nil, nil, nil
 	return ps
 }
 
+// newPoints returns a vector of k points of grp.
+func newPoints(grp kyber.Group, k int) []kyber.Point {
+	v := make([]kyber.Point, k)
+	for i := range v {
+		v[i] = grp.Point()
+	}
+	return v
+}
+
+// newScalars returns a vector of k scalars of grp.
+func newScalars(grp kyber.Group, k int) []kyber.Scalar {
+	v := make([]kyber.Scalar, k)
+	for i := range v {
+		v[i] = grp.Scalar()
+	}
+	return v
+}
+
+// workers returns the number of chunks into which parallel splits k elements.
+func workers(k int) int {
+	n := runtime.GOMAXPROCS(0)
+	if n > k {
+		n = k
+	}
+	return n
+}
+
+// parallel calls f(c, lo, hi) for each chunk c of the workers(k) consecutive
+// chunks [lo, hi) of [0, k), on one goroutine per chunk.
+func parallel(k int, f func(c, lo, hi int)) {
+	n := workers(k)
+	if n <= 1 {
+		f(0, 0, k)
+		return
+	}
+	var wg sync.WaitGroup
+	for c := 0; c < n; c++ {
+		wg.Add(1)
+		go func(c int) {
+			defer wg.Done()
+			f(c, c*k/n, (c+1)*k/n)
+		}(c)
+	}
+	wg.Wait()
+}
+
 // Prove returns an error if the shuffle is not correct.
 func (ps *PairShuffle) Prove(
 	pi []int, g, h kyber.Point, beta []kyber.Scalar,
@@ -133,8 +200,18 @@ func (ps *PairShuffle) Prove(
 		panic("mismatched vector lengths")
 	}
 
+	if ps.piinv == nil {
+		ps.piinv = make([]int, k)
+		ps.u = newScalars(grp, k)
+		ps.w = newScalars(grp, k)
+		ps.a = newScalars(grp, k)
+		ps.b = newScalars(grp, k)
+		ps.r = newScalars(grp, k)
+		ps.s = newScalars(grp, k)
+	}
+
 	// Compute pi^-1 inverse permutation
-	piinv := make([]int, k)
+	piinv := ps.piinv
 	for i := 0; i < k; i++ {
 		piinv[pi[i]] = i
 	}
@@ -144,29 +221,44 @@ func (ps *PairShuffle) Prove(
 	z := grp.Scalar() // scratch
 
 	// pick random secrets
-	u := make([]kyber.Scalar, k)
-	w := make([]kyber.Scalar, k)
-	a := make([]kyber.Scalar, k)
+	u, w, a := ps.u, ps.w, ps.a
 	var tau0, nu, gamma kyber.Scalar
 	ctx.PriRand(u, w, a, &tau0, &nu, &gamma)
 
-	// compute public commits
-	p1.Gamma = grp.Point().Mul(gamma, g)
-	wbeta := grp.Scalar() // scratch
+	// compute public commits, with partial sums for each chunk
+	p1.Gamma.Mul(gamma, g)
+	n := workers(k)
+	wbetasums := make([]kyber.Scalar, n)
+	lambda1s := make([]kyber.Point, n)
+	lambda2s := make([]kyber.Point, n)
+	parallel(k, func(c, lo, hi int) {
+		z := grp.Scalar()  // scratch
+		wu := grp.Scalar() // scratch
+		XY := grp.Point()  // scratch
+		wbetasum := grp.Scalar().Zero()
+		lambda1 := grp.Point().Null()
+		lambda2 := grp.Point().Null()
+		for i := lo; i < hi; i++ {
+			p1.A[i].Mul(a[i], g)
+			p1.C[i].Mul(z.Mul(gamma, a[pi[i]]), g)
+			p1.U[i].Mul(u[i], g)
+			p1.W[i].Mul(z.Mul(gamma, w[i]), g)
+			wbetasum.Add(wbetasum, z.Mul(w[i], beta[pi[i]]))
+			wu.Sub(w[piinv[i]], u[i])
+			lambda1.Add(lambda1, XY.Mul(wu, X[i]))
+			lambda2.Add(lambda2, XY.Mul(wu, Y[i]))
+		}
+		wbetasums[c], lambda1s[c], lambda2s[c] = wbetasum, lambda1, lambda2
+	})
 	wbetasum := grp.Scalar().Set(tau0)
-	p1.Lambda1 = grp.Point().Null()
-	p1.Lambda2 = grp.Point().Null()
-	XY := grp.Point()  // scratch
-	wu := grp.Scalar() // scratch
-	for i := 0; i < k; i++ {
-		p1.A[i] = grp.Point().Mul(a[i], g)
-		p1.C[i] = grp.Point().Mul(z.Mul(gamma, a[pi[i]]), g)
-		p1.U[i] = grp.Point().Mul(u[i], g)
-		p1.W[i] = grp.Point().Mul(z.Mul(gamma, w[i]), g)
-		wbetasum.Add(wbetasum, wbeta.Mul(w[i], beta[pi[i]]))
-		p1.Lambda1.Add(p1.Lambda1, XY.Mul(wu.Sub(w[piinv[i]], u[i]), X[i]))
-		p1.Lambda2.Add(p1.Lambda2, XY.Mul(wu.Sub(w[piinv[i]], u[i]), Y[i]))
-	}
+	p1.Lambda1.Null()
+	p1.Lambda2.Null()
+	for c := 0; c < n; c++ {
+		wbetasum.Add(wbetasum, wbetasums[c])
+		p1.Lambda1.Add(p1.Lambda1, lambda1s[c])
+		p1.Lambda2.Add(p1.Lambda2, lambda2s[c])
+	}
+	XY := grp.Point() // scratch
 	p1.Lambda1.Add(p1.Lambda1, XY.Mul(wbetasum, g))
 	p1.Lambda2.Add(p1.Lambda2, XY.Mul(wbetasum, h))
 	if err := ctx.Put(p1); err != nil {
@@ -178,23 +270,19 @@ func (ps *PairShuffle) Prove(
 	if err := ctx.PubRand(v2); err != nil {
 		return err
 	}
-	B := make([]kyber.Point, k)
-	for i := 0; i < k; i++ {
-		P := grp.Point().Mul(v2.Zrho[i], g)
-		B[i] = P.Sub(P, p1.U[i])
-	}
 
 	// P step 3
 	p3 := &ps.p3
-	b := make([]kyber.Scalar, k)
-	for i := 0; i < k; i++ {
-		b[i] = grp.Scalar().Sub(v2.Zrho[i], u[i])
-	}
-	d := make([]kyber.Scalar, k)
+	b := ps.b
 	for i := 0; i < k; i++ {
-		d[i] = grp.Scalar().Mul(gamma, b[pi[i]])
-		p3.D[i] = grp.Point().Mul(d[i], g)
+		b[i].Sub(v2.Zrho[i], u[i])
 	}
+	parallel(k, func(_, lo, hi int) {
+		d := grp.Scalar() // scratch
+		for i := lo; i < hi; i++ {
+			p3.D[i].Mul(d.Mul(gamma, b[pi[i]]), g)
+		}
+	})
 	if err := ctx.Put(p3); err != nil {
 		return err
 	}
@@ -207,17 +295,17 @@ func (ps *PairShuffle) Prove(
 
 	// P step 5
 	p5 := &ps.p5
-	r := make([]kyber.Scalar, k)
+	r := ps.r
 	for i := 0; i < k; i++ {
-		r[i] = grp.Scalar().Add(a[i], z.Mul(v4.Zlambda, b[i]))
+		r[i].Add(a[i], z.Mul(v4.Zlambda, b[i]))
 	}
-	s := make([]kyber.Scalar, k)
+	s := ps.s
 	for i := 0; i < k; i++ {
-		s[i] = grp.Scalar().Mul(gamma, r[pi[i]])
+		s[i].Mul(gamma, r[pi[i]])
 	}
 	p5.Ztau = grp.Scalar().Neg(tau0)
 	for i := 0; i < k; i++ {
-		p5.Zsigma[i] = grp.Scalar().Add(w[i], b[pi[i]])
+		p5.Zsigma[i].Add(w[i], b[pi[i]])
 		p5.Ztau.Add(p5.Ztau, z.Mul(b[i], beta[i]))
 	}
 	if err := ctx.Put(p5); err != nil {
@@ -251,11 +339,6 @@ func (ps *PairShuffle) Verify(
 	if err := ctx.PubRand(v2); err != nil {
 		return err
 	}
-	B := make([]kyber.Point, k)
-	for i := 0; i < k; i++ {
-		P := grp.Point().Mul(v2.Zrho[i], g)
-		B[i] = P.Sub(P, p1.U[i])
-	}
 
 	// P step 3
 	p3 := &ps.p3
@@ -280,29 +363,44 @@ func (ps *PairShuffle) Verify(
 		return err
 	}
 
-	// V step 7
-	Phi1 := grp.Point().Null()
-	Phi2 := grp.Point().Null()
-	P := grp.Point() // scratch
-	Q := grp.Point() // scratch
-	for i := 0; i < k; i++ {
-		Phi1 = Phi1.Add(Phi1, P.Mul(p5.Zsigma[i], Xbar[i])) // (31)
-		Phi1 = Phi1.Sub(Phi1, P.Mul(v2.Zrho[i], X[i]))
-		Phi2 = Phi2.Add(Phi2, P.Mul(p5.Zsigma[i], Ybar[i])) // (32)
-		Phi2 = Phi2.Sub(Phi2, P.Mul(v2.Zrho[i], Y[i]))
-		//		println("i",i)
-		if !P.Mul(p5.Zsigma[i], p1.Gamma).Equal( // (33)
-			Q.Add(p1.W[i], p3.D[i])) {
+	// V step 7: check (33) for each element
+	ok := make([]bool, workers(k))
+	parallel(k, func(c, lo, hi int) {
+		P := grp.Point() // scratch
+		Q := grp.Point() // scratch
+		for i := lo; i < hi; i++ {
+			if !P.Mul(p5.Zsigma[i], p1.Gamma).Equal(Q.Add(p1.W[i], p3.D[i])) {
+				return
+			}
+		}
+		ok[c] = true
+	})
+	for _, okc := range ok {
+		if !okc {
 			return errors.New("invalid PairShuffleProof")
 		}
 	}
-	//	println("last")
-	//	println("Phi1",Phi1.String());
-	//	println("Phi2",Phi2.String());
-	//	println("1",P.Add(p1.Lambda1,Q.Mul(g,p5.Ztau)).String());
-	//	println("2",P.Add(p1.Lambda2,Q.Mul(h,p5.Ztau)).String());
-	if !P.Add(p1.Lambda1, Q.Mul(p5.Ztau, g)).Equal(Phi1) || // (34)
-		!P.Add(p1.Lambda2, Q.Mul(p5.Ztau, h)).Equal(Phi2) { // (35)
+
+	// Check (34) and (35), Lambda1 + Ztau·g == Phi1 and Lambda2 + Ztau·h ==
+	// Phi2 with Phi1 and Phi2 the sums (31) and (32), as one multi-scalar
+	// multiplication each.
+	if ps.scalars == nil {
+		ps.scalars = append(make([]kyber.Scalar, k), newScalars(grp, k+1)...)
+		ps.points = make([]kyber.Point, 2*k+1)
+	}
+	scalars, points := ps.scalars, ps.points
+	for i := 0; i < k; i++ {
+		scalars[i] = p5.Zsigma[i]
+		scalars[k+i].Neg(v2.Zrho[i])
+	}
+	scalars[2*k].Neg(p5.Ztau)
+	check := func(Xbar, X []kyber.Point, g, Lambda kyber.Point) bool {
+		copy(points, Xbar)
+		copy(points[k:], X)
+		points[2*k] = g
+		return msm.MultiScalarMul(grp, scalars, points).Equal(Lambda)
+	}
+	if !check(Xbar, X, g, p1.Lambda1) || !check(Ybar, Y, h, p1.Lambda2) {
 		return errors.New("invalid PairShuffleProof")
 	}
 
@@ -347,12 +445,14 @@ func Shuffle(group kyber.Group, g, h kyber.Point, X, Y []kyber.Point,
 	// Create the output pair vectors
 	Xbar := make([]kyber.Point, k)
 	Ybar := make([]kyber.Point, k)
-	for i := 0; i < k; i++ {
-		Xbar[i] = ps.grp.Point().Mul(beta[pi[i]], g)
-		Xbar[i].Add(Xbar[i], X[pi[i]])
-		Ybar[i] = ps.grp.Point().Mul(beta[pi[i]], h)
-		Ybar[i].Add(Ybar[i], Y[pi[i]])
-	}
+	parallel(k, func(_, lo, hi int) {
+		for i := lo; i < hi; i++ {
+			Xbar[i] = ps.grp.Point().Mul(beta[pi[i]], g)
+			Xbar[i].Add(Xbar[i], X[pi[i]])
+			Ybar[i] = ps.grp.Point().Mul(beta[pi[i]], h)
+			Ybar[i].Add(Ybar[i], Y[pi[i]])
+		}
+	})
 
 	prover := func(ctx proof.ProverContext) error {
 		return ps.Prove(pi, g, h, beta, X, Y, rand, ctx)
@@ -3,6 +3,7 @@ package shuffle
 import (
 	"testing"
 
+	"github.com/stretchr/testify/require"
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/edwards25519"
 	"go.dedis.ch/kyber/v3/proof"
@@ -64,3 +65,36 @@ func shuffleTest(suite Suite, k, N int) {
 		}
 	}
 }
+
+// TestPairShuffleReuse runs the prover of a shuffle twice and checks both
+// proofs with the same PairShuffle, so that the reused vectors of both
+// sides are exercised.
+func TestPairShuffleReuse(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519WithRand(blake2xb.New(nil))
+	rand := suite.RandomStream()
+	k := 20
+	H := suite.Point().Pick(rand)
+	X := make([]kyber.Point, k)
+	Y := make([]kyber.Point, k)
+	for i := range X {
+		X[i] = suite.Point().Pick(rand)
+		Y[i] = suite.Point().Pick(rand)
+	}
+
+	Xbar, Ybar, prover := Shuffle(suite, nil, H, X, Y, rand)
+	prf1, err := proof.HashProve(suite, "PairShuffle", prover)
+	require.NoError(t, err)
+	prf2, err := proof.HashProve(suite, "PairShuffle", prover)
+	require.NoError(t, err)
+	require.NotEqual(t, prf1, prf2)
+
+	ps := new(PairShuffle).Init(suite, k)
+	verifier := func(ctx proof.VerifierContext) error {
+		return ps.Verify(nil, H, X, Y, Xbar, Ybar, ctx)
+	}
+	require.NoError(t, proof.HashVerify(suite, "PairShuffle", verifier, prf1))
+	require.NoError(t, proof.HashVerify(suite, "PairShuffle", verifier, prf2))
+
+	Xbar[0], Xbar[1] = Xbar[1], Xbar[0]
+	require.Error(t, proof.HashVerify(suite, "PairShuffle", verifier, prf1))
+}
@@ -8,15 +8,79 @@ import (
 	"crypto/sha256"
 	"errors"
 	"fmt"
+	"runtime"
+	"sync"
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/pairing"
+	"go.dedis.ch/kyber/v3/util/msm"
+	"go.dedis.ch/kyber/v3/util/random"
 )
 
 type hashablePoint interface {
 	Hash([]byte) kyber.Point
 }
 
+// hashToCurvePoint is implemented by the points that hash messages to the
+// curve in constant time, such as those of bn256.G1.
+type hashToCurvePoint interface {
+	HashToCurve(msg, dst []byte) kyber.Point
+}
+
+// batchHasher is implemented by the groups that hash many messages at once,
+// such as bn256.G1, whose points then share their allocations.
+type batchHasher interface {
+	HashBatch(msgs [][]byte) []kyber.Point
+}
+
+// hashToCurveSuite is a suite whose messages are hashed with HashToCurve, see
+// NewHashToCurveSuite.
+type hashToCurveSuite struct {
+	pairing.Suite
+	dst []byte
+}
+
+// NewHashToCurveSuite returns a suite that behaves like suite, except that
+// the functions of this package hash messages to G1 with HashToCurve and the
+// domain separation tag dst, in constant time, instead of Hash, whose time
+// depends on the message. The signatures are not compatible with those made
+// with suite itself, which keeps the encoding of existing signatures. It
+// returns an error if the G1 points of suite do not implement HashToCurve.
+func NewHashToCurveSuite(suite pairing.Suite, dst []byte) (pairing.Suite, error) {
+	if _, ok := suite.G1().Point().(hashToCurvePoint); !ok {
+		return nil, errors.New("bls: point needs to implement HashToCurve")
+	}
+	return &hashToCurveSuite{Suite: suite, dst: append([]byte(nil), dst...)}, nil
+}
+
+// hasher returns the function that hashes a message to G1 for suite.
+func hasher(suite pairing.Suite) (func(msg []byte) kyber.Point, error) {
+	if s, ok := suite.(*hashToCurveSuite); ok {
+		return func(msg []byte) kyber.Point {
+			return s.G1().Point().(hashToCurvePoint).HashToCurve(msg, s.dst)
+		}, nil
+	}
+	if _, ok := suite.G1().Point().(hashablePoint); !ok {
+		return nil, errors.New("bls: point needs to implement hashablePoint")
+	}
+	return func(msg []byte) kyber.Point {
+		return suite.G1().Point().(hashablePoint).Hash(msg)
+	}, nil
+}
+
+// hashes returns a function that hashes msgs[i] to G1 with hash, the hasher
+// of suite. If the group hashes in batches with Hash, the messages are all
+// hashed beforehand.
+func hashes(suite pairing.Suite, hash func([]byte) kyber.Point, msgs [][]byte) func(i int) kyber.Point {
+	if _, ok := suite.(*hashToCurveSuite); !ok {
+		if b, ok := suite.G1().(batchHasher); ok {
+			hs := b.HashBatch(msgs)
+			return func(i int) kyber.Point { return hs[i] }
+		}
+	}
+	return func(i int) kyber.Point { return hash(msgs[i]) }
+}
+
 // NewKeyPair creates a new BLS signing key pair. The private key x is a scalar
 // and the public key X is a point on curve G2.
 func NewKeyPair(suite pairing.Suite, random cipher.Stream) (kyber.Scalar, kyber.Point) {
@@ -27,12 +91,14 @@ func NewKeyPair(suite pairing.Suite, random cipher.Stream) (kyber.Scalar, kyber.
 
 // Sign creates a BLS signature S = x * H(m) on a message m using the private
 // key x. The signature S is a point on curve G1.
+// H is the Hash of the G1 points, or HashToCurve if suite was returned by
+// NewHashToCurveSuite.
 func Sign(suite pairing.Suite, x kyber.Scalar, msg []byte) ([]byte, error) {
-	hashable, ok := suite.G1().Point().(hashablePoint)
-	if !ok {
-		return nil, errors.New("point needs to implement hashablePoint")
+	hash, err := hasher(suite)
+	if err != nil {
+		return nil, err
 	}
-	HM := hashable.Hash(msg)
+	HM := hash(msg)
 	xHM := HM.Mul(x, HM)
 	s, err := xHM.MarshalBinary()
 	if err != nil {
@@ -70,56 +136,150 @@ func AggregatePublicKeys(suite pairing.Suite, Xs ...kyber.Point) kyber.Point {
 // Every msg must be unique or there is the possibility to accept an invalid signature
 // see: https://crypto.stackexchange.com/questions/56288/is-bls-signature-scheme-strongly-unforgeable/56290
 // for a description of why each message must be unique.
+// The public keys may be prepared for pairings, e.g. with bn256.NewPreparedG2.
+// The messages are hashed, in one batch if the group of the signatures
+// supports it, and paired by GOMAXPROCS goroutines.
 func BatchVerify(suite pairing.Suite, publics []kyber.Point, msgs [][]byte, sig []byte) error {
 	if !distinct(msgs) {
 		return fmt.Errorf("bls: error, messages must be distinct")
 	}
+	if len(publics) != len(msgs) {
+		return fmt.Errorf("bls: error, got %d public keys for %d messages", len(publics), len(msgs))
+	}
+	hash, err := hasher(suite)
+	if err != nil {
+		return err
+	}
 
 	s := suite.G1().Point()
 	if err := s.UnmarshalBinary(sig); err != nil {
 		return err
 	}
 
-	var aggregatedLeft kyber.Point
-	for i := range msgs {
-		hashable, ok := suite.G1().Point().(hashablePoint)
-		if !ok {
-			return errors.New("bls: point needs to implement hashablePoint")
-		}
-		hm := hashable.Hash(msgs[i])
-		pair := suite.Pair(hm, publics[i])
+	// The product of e(H(mᵢ), Xᵢ) must equal e(S, B2), which is checked as
+	// e(H(m₁), X₁)···e(H(mₙ), Xₙ)·e(-S, B2) == 1 with one final
+	// exponentiation.
+	hashMsg := hashes(suite, hash, msgs)
+	pair := func(i int) (kyber.Point, kyber.Point) {
+		return hashMsg(i), publics[i]
+	}
+	if !pairingCheck(suite, len(msgs), pair, s.Neg(s), suite.G2().Point().Base()) {
+		return errors.New("bls: invalid signature")
+	}
+	return nil
+}
+
+// BatchVerifySignatures verifies the signatures sigs[i] on msgs[i] under the
+// public keys publics[i] at once. Unlike BatchVerify, the signatures are
+// independent and the messages need not be distinct. Each signature Sᵢ is
+// weighted with a random 128-bit scalar rᵢ, and
+// e(r₁H(m₁), X₁)···e(rₙH(mₙ), Xₙ)·e(-(r₁S₁+...+rₙSₙ), B2) == 1 is checked
+// with one final exponentiation. Since the weights are unknown to the signers,
+// an invalid signature makes the check fail except with probability 2^-128.
+// If it fails, Verify tells which signatures are invalid.
+func BatchVerifySignatures(suite pairing.Suite, publics []kyber.Point, msgs, sigs [][]byte) error {
+	if len(publics) != len(msgs) || len(sigs) != len(msgs) {
+		return fmt.Errorf("bls: error, got %d public keys and %d signatures for %d messages",
+			len(publics), len(sigs), len(msgs))
+	}
+	hash, err := hasher(suite)
+	if err != nil {
+		return err
+	}
 
-		if i == 0 {
-			aggregatedLeft = pair
-		} else {
-			aggregatedLeft.Add(aggregatedLeft, pair)
+	rs := make([]kyber.Scalar, len(sigs))
+	ss := make([]kyber.Point, len(sigs))
+	for i := range sigs {
+		ss[i] = suite.G1().Point()
+		if err := ss[i].UnmarshalBinary(sigs[i]); err != nil {
+			return err
 		}
+		rs[i] = suite.G1().Scalar().SetBytes(random.Bits(128, false, suite.RandomStream()))
 	}
+	s := msm.MultiScalarMul(suite.G1(), rs, ss)
 
-	right := suite.Pair(s, suite.G2().Point().Base())
-	if !aggregatedLeft.Equal(right) {
+	hashMsg := hashes(suite, hash, msgs)
+	pair := func(i int) (kyber.Point, kyber.Point) {
+		h := hashMsg(i)
+		return h.Mul(rs[i], h), publics[i]
+	}
+	if !pairingCheck(suite, len(msgs), pair, s.Neg(s), suite.G2().Point().Base()) {
 		return errors.New("bls: invalid signature")
 	}
 	return nil
 }
 
+// pairingCheck returns whether the product of the pairings of the n pairs
+// pair(i) and of (q1, q2) is the identity of GT. The pairs are split among up
+// to GOMAXPROCS goroutines, which compute them and, if the GT points of the
+// suite implement pairing.MillerLooper, the products of their Miller loops.
+// The products are then multiplied and share one final exponentiation.
+func pairingCheck(suite pairing.Suite, n int, pair func(i int) (kyber.Point, kyber.Point),
+	q1, q2 kyber.Point) bool {
+
+	p1s := make([]kyber.Point, n+1)
+	p2s := make([]kyber.Point, n+1)
+	p1s[n], p2s[n] = q1, q2
+
+	_, looper := suite.GT().Point().(pairing.MillerLooper)
+	workers := runtime.GOMAXPROCS(0)
+	chunk := (n + workers) / workers
+	var partials []kyber.Point
+	var wg sync.WaitGroup
+	for lo := 0; lo <= n; lo += chunk {
+		hi := lo + chunk
+		if hi > n+1 {
+			hi = n + 1
+		}
+		var gt kyber.Point
+		if looper {
+			gt = suite.GT().Point()
+			partials = append(partials, gt)
+		}
+
+		wg.Add(1)
+		go func(lo, hi int) {
+			defer wg.Done()
+			for i := lo; i < hi && i < n; i++ {
+				p1s[i], p2s[i] = pair(i)
+			}
+			if gt != nil {
+				gt.(pairing.MillerLooper).MultiMiller(p1s[lo:hi], p2s[lo:hi])
+			}
+		}(lo, hi)
+	}
+	wg.Wait()
+
+	if !looper {
+		return suite.PairingCheck(p1s, p2s)
+	}
+	prod := partials[0]
+	for _, gt := range partials[1:] {
+		prod.Add(prod, gt)
+	}
+	return prod.(pairing.MillerLooper).Finalize().Equal(suite.GT().Point().Null())
+}
+
 // Verify checks the given BLS signature S on the message m using the public
 // key X by verifying that the equality e(H(m), X) == e(H(m), x*B2) ==
 // e(x*H(m), B2) == e(S, B2) holds where e is the pairing operation and B2 is
-// the base point from curve G2.
+// the base point from curve G2. X may be prepared for pairings, e.g. with
+// bn256.NewPreparedG2, to save its share of the pairing computation.
 func Verify(suite pairing.Suite, X kyber.Point, msg, sig []byte) error {
-	hashable, ok := suite.G1().Point().(hashablePoint)
-	if !ok {
-		return errors.New("bls: point needs to implement hashablePoint")
+	hash, err := hasher(suite)
+	if err != nil {
+		return err
 	}
-	HM := hashable.Hash(msg)
-	left := suite.Pair(HM, X)
+	HM := hash(msg)
 	s := suite.G1().Point()
 	if err := s.UnmarshalBinary(sig); err != nil {
 		return err
 	}
-	right := suite.Pair(s, suite.G2().Point().Base())
-	if !left.Equal(right) {
+	// e(H(m), X) == e(S, B2) is checked as e(H(m), X)·e(-S, B2) == 1, which
+	// only needs one final exponentiation.
+	p1s := []kyber.Point{HM, s.Neg(s)}
+	p2s := []kyber.Point{X, suite.G2().Point().Base()}
+	if !suite.PairingCheck(p1s, p2s) {
 		return errors.New("bls: invalid signature")
 	}
 	return nil
@@ -114,6 +114,27 @@ func TestBLSBatchVerify(t *testing.T) {
 	err = BatchVerify(suite, []kyber.Point{public1, public2}, [][]byte{msg1, msg2}, aggregatedSig)
 	require.Nil(t, err)
 }
+func TestBLSPreparedKeys(t *testing.T) {
+	msg1 := []byte("Hello Boneh-Lynn-Shacham")
+	msg2 := []byte("Hello Dedis & Boneh-Lynn-Shacham")
+	suite := bn256.NewSuite()
+	private1, public1 := NewKeyPair(suite, random.New())
+	private2, public2 := NewKeyPair(suite, random.New())
+	prepared1 := bn256.NewPreparedG2(public1)
+	prepared2 := bn256.NewPreparedG2(public2)
+	sig1, err := Sign(suite, private1, msg1)
+	require.Nil(t, err)
+	sig2, err := Sign(suite, private2, msg2)
+	require.Nil(t, err)
+
+	require.Nil(t, Verify(suite, prepared1, msg1, sig1))
+	require.NotNil(t, Verify(suite, prepared2, msg1, sig1))
+
+	aggregatedSig, err := AggregateSignatures(suite, sig1, sig2)
+	require.Nil(t, err)
+	err = BatchVerify(suite, []kyber.Point{prepared1, public2}, [][]byte{msg1, msg2}, aggregatedSig)
+	require.Nil(t, err)
+}
 func TestBLSFailBatchVerify(t *testing.T) {
 	msg1 := []byte("Hello Boneh-Lynn-Shacham")
 	msg2 := []byte("Hello Dedis & Boneh-Lynn-Shacham")
@@ -148,6 +169,93 @@ func TestBLSFailBatchVerify(t *testing.T) {
 
 }
 
+func TestBLSBatchVerifyMany(t *testing.T) {
+	suite := bn256.NewSuite()
+	n := 20
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range msgs {
+		var private kyber.Scalar
+		private, publics[i] = NewKeyPair(suite, random.New())
+		msgs[i] = []byte{byte(i)}
+		sig, err := Sign(suite, private, msgs[i])
+		require.Nil(t, err)
+		sigs[i] = sig
+	}
+	aggregatedSig, err := AggregateSignatures(suite, sigs...)
+	require.Nil(t, err)
+
+	require.Nil(t, BatchVerify(suite, publics, msgs, aggregatedSig))
+	publics[n-1] = publics[0]
+	require.NotNil(t, BatchVerify(suite, publics, msgs, aggregatedSig))
+}
+
+func TestBLSBatchVerifySignatures(t *testing.T) {
+	suite := bn256.NewSuite()
+	msg1 := []byte("Hello Boneh-Lynn-Shacham")
+	msg2 := []byte("Hello Dedis & Boneh-Lynn-Shacham")
+	n := 10
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range msgs {
+		var private kyber.Scalar
+		private, publics[i] = NewKeyPair(suite, random.New())
+		// The messages need not be distinct.
+		msgs[i] = msg1
+		if i%2 == 1 {
+			msgs[i] = msg2
+		}
+		sig, err := Sign(suite, private, msgs[i])
+		require.Nil(t, err)
+		sigs[i] = sig
+	}
+	publics[0] = bn256.NewPreparedG2(publics[0])
+
+	require.Nil(t, BatchVerifySignatures(suite, publics, msgs, sigs))
+	require.Nil(t, BatchVerifySignatures(suite, nil, nil, nil))
+	require.NotNil(t, BatchVerifySignatures(suite, publics[1:], msgs, sigs))
+
+	// Swapping two signatures keeps their aggregate, but not the random
+	// linear combination.
+	sigs[2], sigs[4] = sigs[4], sigs[2]
+	require.NotNil(t, BatchVerifySignatures(suite, publics, msgs, sigs))
+}
+
+func TestBLSHashToCurve(t *testing.T) {
+	msg := []byte("Hello Boneh-Lynn-Shacham")
+	suite := bn256.NewSuite()
+	htc, err := NewHashToCurveSuite(suite, []byte("BLS_SIG_BN256G1_XMD:SHA-256_SVDW_RO_NUL_"))
+	require.Nil(t, err)
+	private, public := NewKeyPair(htc, random.New())
+	sig, err := Sign(htc, private, msg)
+	require.Nil(t, err)
+	require.Nil(t, Verify(htc, public, msg, sig))
+
+	// The signatures of the two hashes are not interchangeable.
+	require.NotNil(t, Verify(suite, public, msg, sig))
+	sig2, err := Sign(suite, private, msg)
+	require.Nil(t, err)
+	require.NotEqual(t, sig, sig2)
+	require.NotNil(t, Verify(htc, public, msg, sig2))
+
+	msgs := [][]byte{msg, []byte("Hello Dedis & Boneh-Lynn-Shacham")}
+	publics := make([]kyber.Point, len(msgs))
+	sigs := make([][]byte, len(msgs))
+	for i := range msgs {
+		private, publics[i] = NewKeyPair(htc, random.New())
+		sigs[i], err = Sign(htc, private, msgs[i])
+		require.Nil(t, err)
+	}
+	require.Nil(t, BatchVerifySignatures(htc, publics, msgs, sigs))
+	require.NotNil(t, BatchVerifySignatures(suite, publics, msgs, sigs))
+	aggregatedSig, err := AggregateSignatures(htc, sigs...)
+	require.Nil(t, err)
+	require.Nil(t, BatchVerify(htc, publics, msgs, aggregatedSig))
+	require.NotNil(t, BatchVerify(suite, publics, msgs, aggregatedSig))
+}
+
 func BenchmarkBLSKeyCreation(b *testing.B) {
 	suite := bn256.NewSuite()
 	b.ResetTimer()
@@ -225,3 +333,27 @@ func BenchmarkBLSVerifyBatchVerify(b *testing.B) {
 		BatchVerify(suite, publics, msgs, aggregateSig)
 	}
 }
+
+func BenchmarkBLSBatchVerifySignatures(b *testing.B) {
+	suite := bn256.NewSuite()
+
+	numSigs := 100
+	publics := make([]kyber.Point, numSigs)
+	msgs := make([][]byte, numSigs)
+	sigs := make([][]byte, numSigs)
+	for i := 0; i < numSigs; i++ {
+		private, public := NewKeyPair(suite, random.New())
+		publics[i] = public
+		msg := make([]byte, 64, 64)
+		rand.Read(msg)
+		msgs[i] = msg
+		sig, err := Sign(suite, private, msg)
+		require.Nil(b, err)
+		sigs[i] = sig
+	}
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		BatchVerifySignatures(suite, publics, msgs, sigs)
+	}
+}
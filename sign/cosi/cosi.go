@@ -42,8 +42,10 @@ package cosi
 import (
 	"errors"
 	"fmt"
+	"math/bits"
 
 	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/msm"
 )
 
 // Commit returns a random scalar v, generated from the given suite,
@@ -85,6 +87,9 @@ func Challenge(suite Suite, commitment, public kyber.Point, message []byte) (kyb
 		return nil, errors.New("no message provided")
 	}
 	hash := suite.Hash()
+	if p, ok := suite.(kyber.HashPool); ok {
+		defer p.PutHash(hash)
+	}
 	if _, err := commitment.MarshalTo(hash); err != nil {
 		return nil, err
 	}
@@ -159,6 +164,20 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 	if publics == nil {
 		return errors.New("no public keys provided")
 	}
+	mask, err := NewMask(suite, publics, nil)
+	if err != nil {
+		return err
+	}
+	return VerifyMask(suite, mask, message, sig, policy)
+}
+
+// VerifyMask is like Verify, but takes the public keys from mask, to which it
+// applies the participation bitmask of the signature. The aggregate public
+// key of mask is updated with the keys whose bits differ from those already
+// set, so reusing one Mask for the signatures of a mostly stable set of
+// cosigners costs one point addition per changed bit instead of one per
+// cosigner.
+func VerifyMask(suite Suite, mask *Mask, message, sig []byte, policy Policy) error {
 	if message == nil {
 		return errors.New("no message provided")
 	}
@@ -188,11 +207,9 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 	r := suite.Scalar().SetBytes(rBuff)
 
 	// Unpack the participation mask and get the aggregate public key
-	mask, err := NewMask(suite, publics, nil)
-	if err != nil {
+	if err := mask.SetMask(sig[lenRes:]); err != nil {
 		return err
 	}
-	mask.SetMask(sig[lenRes:])
 	A := mask.AggregatePublic
 	ABuff, err := A.MarshalBinary()
 	if err != nil {
@@ -201,6 +218,9 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 
 	// Recompute the challenge
 	hash := suite.Hash()
+	if p, ok := suite.(kyber.HashPool); ok {
+		defer p.PutHash(hash)
+	}
 	hash.Write(VBuff)
 	hash.Write(ABuff)
 	hash.Write(message)
@@ -211,9 +231,7 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 	// from s = k * a + r => s * B = k * a * B + r * B <=> s*B = k*A + r*B
 	// <=> s*B + k*-A = r*B
 	minusPublic := suite.Point().Neg(A)
-	kA := suite.Point().Mul(k, minusPublic)
-	sB := suite.Point().Mul(r, nil)
-	left := suite.Point().Add(kA, sB)
+	left := msm.MultiScalarMul(suite, []kyber.Scalar{k, r}, []kyber.Point{minusPublic, nil})
 
 	if !left.Equal(V) {
 		return errors.New("recreated response is different from signature")
@@ -225,11 +243,16 @@ func Verify(suite Suite, publics []kyber.Point, message, sig []byte, policy Poli
 	return nil
 }
 
-// Mask represents a cosigning participation bitmask.
+// Mask represents a cosigning participation bitmask. It keeps the sum of the
+// enabled public keys in AggregatePublic, which it updates as bits change.
 type Mask struct {
 	mask            []byte
 	publics         []kyber.Point
 	AggregatePublic kyber.Point
+
+	prepare      func(kyber.Point) kyber.Point
+	prepared     kyber.Point // cache of PreparedPublic
+	preparedFrom kyber.Point // copy of the AggregatePublic of prepared
 }
 
 // NewMask returns a new participation bitmask for cosigning where all
@@ -258,6 +281,20 @@ func NewMask(suite Suite, publics []kyber.Point, myKey kyber.Point) (*Mask, erro
 	return m, nil
 }
 
+// NewPreparedMask is like NewMask, but PreparedPublic returns the aggregate
+// public key as transformed by prepare, for instance by bn256.NewPreparedG2 for
+// BLS multisignatures.
+func NewPreparedMask(suite Suite, publics []kyber.Point, myKey kyber.Point,
+	prepare func(kyber.Point) kyber.Point) (*Mask, error) {
+
+	m, err := NewMask(suite, publics, myKey)
+	if err != nil {
+		return nil, err
+	}
+	m.prepare = prepare
+	return m, nil
+}
+
 // Mask returns a copy of the participation bitmask.
 func (m *Mask) Mask() []byte {
 	clone := make([]byte, len(m.mask))
@@ -277,16 +314,15 @@ func (m *Mask) SetMask(mask []byte) error {
 	if m.Len() != len(mask) {
 		return fmt.Errorf("mismatching mask lengths")
 	}
-	for i := range m.publics {
-		byt := i >> 3
-		msk := byte(1) << uint(i&7)
-		if ((m.mask[byt] & msk) == 0) && ((mask[byt] & msk) != 0) {
-			m.mask[byt] ^= msk // flip bit in mask from 0 to 1
-			m.AggregatePublic.Add(m.AggregatePublic, m.publics[i])
-		}
-		if ((m.mask[byt] & msk) != 0) && ((mask[byt] & msk) == 0) {
-			m.mask[byt] ^= msk // flip bit in mask from 1 to 0
-			m.AggregatePublic.Sub(m.AggregatePublic, m.publics[i])
+	// Only visit the bits that differ, so that the cost is in the number of
+	// changed bits rather than of cosigners.
+	for byt := range mask {
+		for diff := m.mask[byt] ^ mask[byt]; diff != 0; diff &= diff - 1 {
+			i := byt<<3 + bits.TrailingZeros8(diff)
+			if i >= len(m.publics) {
+				break
+			}
+			m.SetBit(i, mask[byt]&(byte(1)<<uint(i&7)) != 0)
 		}
 	}
 	return nil
@@ -311,6 +347,23 @@ func (m *Mask) SetBit(i int, enable bool) error {
 	return nil
 }
 
+// PreparedPublic returns the aggregate public key as transformed by the
+// prepare function of NewPreparedMask, or AggregatePublic itself for a Mask
+// from NewMask. The result is cached as long as AggregatePublic equals the
+// key it was prepared from, so that the cosignatures of the same cosigners on
+// different messages prepare their key once, also if AggregatePublic is
+// modified directly. It must not be modified.
+func (m *Mask) PreparedPublic() kyber.Point {
+	if m.prepare == nil {
+		return m.AggregatePublic
+	}
+	if m.prepared == nil || !m.preparedFrom.Equal(m.AggregatePublic) {
+		m.preparedFrom = m.AggregatePublic.Clone()
+		m.prepared = m.prepare(m.preparedFrom)
+	}
+	return m.prepared
+}
+
 // IndexEnabled checks whether the given index is enabled in the mask or not.
 func (m *Mask) IndexEnabled(i int) (bool, error) {
 	if i >= len(m.publics) {
@@ -9,8 +9,11 @@ import (
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/edwards25519"
+	"go.dedis.ch/kyber/v3/pairing/bn256"
+	"go.dedis.ch/kyber/v3/sign/bls"
 	"go.dedis.ch/kyber/v3/sign/eddsa"
 	"go.dedis.ch/kyber/v3/util/key"
+	"go.dedis.ch/kyber/v3/util/random"
 	"go.dedis.ch/kyber/v3/xof/blake2xb"
 )
 
@@ -103,6 +106,11 @@ func testCoSi(t *testing.T, n, f int) {
 		t.Fatal(err)
 	}
 
+	// The verifier's mask is reused for all signatures.
+	verifierMask, err := NewMask(testSuite, publics, nil)
+	if err != nil {
+		t.Fatal(err)
+	}
 	for i := 0; i < n-f; i++ {
 		// Sign
 		sig, err := Sign(testSuite, aggV, aggr, masks[i])
@@ -123,6 +131,9 @@ func testCoSi(t *testing.T, n, f int) {
 		if err := Verify(testSuite, publics, message, sig, p); err != nil {
 			t.Fatal(err)
 		}
+		if err := VerifyMask(testSuite, verifierMask, message, sig, p); err != nil {
+			t.Fatal(err)
+		}
 		// cosi signature should follow the same format as EdDSA except it has no mask
 		maskLen := len(masks[i].Mask())
 		if err := eddsa.Verify(masks[i].AggregatePublic, message, sig[0:len(sig)-maskLen]); err != nil {
@@ -188,3 +199,128 @@ func TestMask(t *testing.T) {
 		}
 	}
 }
+
+func TestMaskSetMask(t *testing.T) {
+	n := 21
+	var publics []kyber.Point
+	for i := 0; i < n; i++ {
+		publics = append(publics, key.NewKeyPair(testSuite).Public)
+	}
+	prepared := 0
+	prepare := func(p kyber.Point) kyber.Point {
+		prepared++
+		return p.Clone()
+	}
+	m, err := NewPreparedMask(testSuite, publics, nil, prepare)
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	// Set random masks, with padding bits in the last byte, and check the
+	// aggregate key and its prepared cache against the enabled keys.
+	stream := blake2xb.New(nil)
+	b := make([]byte, m.Len())
+	for k := 0; k < 20; k++ {
+		before := m.AggregatePublic.Clone()
+		flipped := -1
+		if k%4 == 3 {
+			// Only one bit of the previous mask changes.
+			flipped = (5 * k) % n
+			b[flipped>>3] ^= 1 << uint(flipped&7)
+		} else {
+			stream.XORKeyStream(b, b)
+		}
+		if err := m.SetMask(b); err != nil {
+			t.Fatal(err)
+		}
+		if flipped >= 0 {
+			// The aggregate changes by exactly the flipped key.
+			if ok, _ := m.IndexEnabled(flipped); ok {
+				before.Add(before, publics[flipped])
+			} else {
+				before.Sub(before, publics[flipped])
+			}
+			if !m.AggregatePublic.Equal(before) {
+				t.Fatal("single bit change not applied")
+			}
+		}
+		want := testSuite.Point().Null()
+		for i := 0; i < n; i++ {
+			if b[i>>3]&(1<<uint(i&7)) != 0 {
+				want.Add(want, publics[i])
+			}
+		}
+		if !m.AggregatePublic.Equal(want) {
+			t.Fatal("wrong aggregate public key")
+		}
+		for j := 0; j < 2; j++ {
+			if !m.PreparedPublic().Equal(want) {
+				t.Fatal("wrong prepared aggregate public key")
+			}
+		}
+		// Each new mask, including a single changed bit, prepares the key
+		// exactly once.
+		if prepared != k+1 {
+			t.Fatal("prepared aggregate public key not cached")
+		}
+	}
+
+	// Modifying AggregatePublic directly prepares it again.
+	m.AggregatePublic.Add(m.AggregatePublic, publics[0])
+	if !m.PreparedPublic().Equal(m.AggregatePublic) {
+		t.Fatal("stale prepared aggregate public key")
+	}
+	m.AggregatePublic = testSuite.Point().Null()
+	if !m.PreparedPublic().Equal(testSuite.Point().Null()) {
+		t.Fatal("stale prepared aggregate public key")
+	}
+
+	if err := m.SetMask(b[1:]); err == nil {
+		t.Fatal("expected error on short mask")
+	}
+}
+
+// TestMaskBLS aggregates BLS public keys in G2 with a mask and verifies
+// multisignatures against the prepared key.
+func TestMaskBLS(t *testing.T) {
+	suite := bn256.NewSuite()
+	n := 5
+	var privates []kyber.Scalar
+	var publics []kyber.Point
+	for i := 0; i < n; i++ {
+		x, X := bls.NewKeyPair(suite, random.New())
+		privates = append(privates, x)
+		publics = append(publics, X)
+	}
+	prepare := func(p kyber.Point) kyber.Point { return bn256.NewPreparedG2(p) }
+	m, err := NewPreparedMask(bn256.NewSuiteG2(), publics, nil, prepare)
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	for _, signers := range [][]int{{0, 1, 2, 3, 4}, {0, 2, 3}, {0, 2, 3, 4}} {
+		b := make([]byte, m.Len())
+		var sigs [][]byte
+		for _, msg := range []string{"first", "second"} {
+			sigs = sigs[:0]
+			for _, i := range signers {
+				b[i>>3] |= 1 << uint(i&7)
+				sig, err := bls.Sign(suite, privates[i], []byte(msg))
+				if err != nil {
+					t.Fatal(err)
+				}
+				sigs = append(sigs, sig)
+			}
+			aggSig, err := bls.AggregateSignatures(suite, sigs...)
+			if err != nil {
+				t.Fatal(err)
+			}
+			if err := m.SetMask(b); err != nil {
+				t.Fatal(err)
+			}
+			if err := bls.Verify(suite, m.PreparedPublic(), []byte(msg), aggSig); err != nil {
+				t.Fatal(err)
+			}
+		}
+	}
+}
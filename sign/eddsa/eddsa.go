@@ -10,6 +10,7 @@ import (
 
 	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/edwards25519"
+	"go.dedis.ch/kyber/v3/util/msm"
 	"go.dedis.ch/kyber/v3/util/random"
 )
 
@@ -126,40 +127,170 @@ func (e *EdDSA) Sign(msg []byte) ([]byte, error) {
 // Verify uses a public key, a message and a signature. It will return nil if
 // sig is a valid signature for msg created by key public, or an error otherwise.
 func Verify(public kyber.Point, msg, sig []byte) error {
+	R, s, h, err := decode(public, msg, sig)
+	if err != nil {
+		return err
+	}
+	// reconstruct S == k*A + R
+	S := group.Point().Mul(s, nil)
+	hA := group.Point().Mul(h, public)
+	RhA := group.Point().Add(R, hA)
+
+	if !RhA.Equal(S) {
+		return errors.New("reconstructed S is not equal to signature")
+	}
+	return nil
+}
+
+// VerifyCofactored is like Verify, but checks the cofactored equation
+// 8·s·B == 8·R + 8·h·A of RFC 8032, and rejects an R or a public key of small
+// order. It accepts exactly the signatures that BatchVerify accepts, which
+// include those whose R differs from that of a valid signature by a point of
+// small order; Verify rejects these.
+func VerifyCofactored(public kyber.Point, msg, sig []byte) error {
+	R, s, h, err := decodeCofactored(public, msg, sig)
+	if err != nil {
+		return err
+	}
+	// 8·(s·B - R - h·A) must be the identity.
+	P := group.Point().Mul(s, nil)
+	P.Sub(P, R)
+	P.Sub(P, group.Point().Mul(h, public))
+	if !mulCofactor(P).Equal(group.Point().Null()) {
+		return errors.New("reconstructed S is not equal to signature")
+	}
+	return nil
+}
+
+// BatchVerify verifies the signatures sigs[i] on msgs[i] under the public
+// keys publics[i] at once. Each equation s·B == R + h·A is weighted with a
+// random 128-bit scalar z, and the check is that 8·(Σ z·(R + h·A) - (Σ z·s)·B)
+// is the identity, which is computed with one multi-scalar multiplication.
+// An invalid signature makes the check fail except with probability 2^-128.
+// Multiplying by the cofactor 8 makes the result independent of the weights.
+// BatchVerify accepts the same signatures as VerifyCofactored, and not as
+// Verify: see VerifyCofactored for the difference.
+//
+// BatchVerify returns -1 and nil if all signatures are valid. Otherwise, it
+// finds an invalid signature by checking halves of the failed batch, and
+// returns its index and why it is invalid.
+func BatchVerify(publics []kyber.Point, msgs, sigs [][]byte) (int, error) {
+	n := len(sigs)
+	if len(publics) != n || len(msgs) != n {
+		return -1, fmt.Errorf("got %d public keys and %d messages for %d signatures",
+			len(publics), len(msgs), n)
+	}
+
+	// The terms of signature i are z·R, (z·h)·A and -(z·s)·B.
+	Rs := make([]kyber.Point, n)
+	zs := make([]kyber.Scalar, n)
+	zhs := make([]kyber.Scalar, n)
+	zss := make([]kyber.Scalar, n)
+	stream := random.New()
+	for i := range sigs {
+		R, s, h, err := decodeCofactored(publics[i], msgs[i], sigs[i])
+		if err != nil {
+			return i, err
+		}
+		Rs[i] = R
+		zs[i] = group.Scalar().SetBytes(random.Bits(128, false, stream))
+		zhs[i] = h.Mul(zs[i], h)
+		zss[i] = s.Mul(zs[i], s)
+	}
+
+	check := func(lo, hi int) bool {
+		scalars := make([]kyber.Scalar, 0, 2*(hi-lo)+1)
+		points := make([]kyber.Point, 0, 2*(hi-lo)+1)
+		zsSum := group.Scalar().Zero()
+		for i := lo; i < hi; i++ {
+			scalars = append(scalars, zs[i], zhs[i])
+			points = append(points, Rs[i], publics[i])
+			zsSum.Add(zsSum, zss[i])
+		}
+		scalars = append(scalars, zsSum.Neg(zsSum))
+		points = append(points, nil)
+
+		P := msm.MultiScalarMul(group, scalars, points)
+		return mulCofactor(P).Equal(group.Point().Null())
+	}
+	if check(0, n) {
+		return -1, nil
+	}
+
+	// Bisect the failed batch [lo, hi): if its first half passes, the
+	// second one fails.
+	lo, hi := 0, n
+	for hi-lo > 1 {
+		mid := (lo + hi) / 2
+		if check(lo, mid) {
+			lo = mid
+		} else {
+			hi = mid
+		}
+	}
+	if err := VerifyCofactored(publics[lo], msgs[lo], sigs[lo]); err != nil {
+		return lo, err
+	}
+	return lo, errors.New("reconstructed S is not equal to signature")
+}
+
+// decode returns the R and s of sig and the challenge h = H(R || Public || Msg).
+func decode(public kyber.Point, msg, sig []byte) (R kyber.Point, s, h kyber.Scalar, err error) {
 	if len(sig) != 64 {
-		return fmt.Errorf("signature length invalid, expect 64 but got %v", len(sig))
+		return nil, nil, nil, fmt.Errorf("signature length invalid, expect 64 but got %v", len(sig))
 	}
 
-	R := group.Point()
+	R = group.Point()
 	if err := R.UnmarshalBinary(sig[:32]); err != nil {
-		return fmt.Errorf("got R invalid point: %s", err)
+		return nil, nil, nil, fmt.Errorf("got R invalid point: %s", err)
 	}
 
-	s := group.Scalar()
+	s = group.Scalar()
 	if err := s.UnmarshalBinary(sig[32:]); err != nil {
-		return fmt.Errorf("schnorr: s invalid scalar %s", err)
+		return nil, nil, nil, fmt.Errorf("schnorr: s invalid scalar %s", err)
 	}
 
 	// reconstruct h = H(R || Public || Msg)
 	Pbuff, err := public.MarshalBinary()
 	if err != nil {
-		return err
+		return nil, nil, nil, err
 	}
 	hash := sha512.New()
 	_, _ = hash.Write(sig[:32])
 	_, _ = hash.Write(Pbuff)
 	_, _ = hash.Write(msg)
 
-	h := group.Scalar().SetBytes(hash.Sum(nil))
-	// reconstruct S == k*A + R
-	S := group.Point().Mul(s, nil)
-	hA := group.Point().Mul(h, public)
-	RhA := group.Point().Add(R, hA)
+	h = group.Scalar().SetBytes(hash.Sum(nil))
+	return R, s, h, nil
+}
 
-	if !RhA.Equal(S) {
-		return errors.New("reconstructed S is not equal to signature")
+// decodeCofactored is like decode, but rejects an R or a public key of small
+// order, for which the cofactored equation holds regardless of the secret key.
+func decodeCofactored(public kyber.Point, msg, sig []byte) (R kyber.Point, s, h kyber.Scalar, err error) {
+	R, s, h, err = decode(public, msg, sig)
+	if err != nil {
+		return nil, nil, nil, err
 	}
-	return nil
+	if isSmallOrder(public) {
+		return nil, nil, nil, errors.New("public key has small order")
+	}
+	if isSmallOrder(R) {
+		return nil, nil, nil, errors.New("got R of small order")
+	}
+	return R, s, h, nil
+}
+
+// mulCofactor sets P to 8·P and returns it.
+func mulCofactor(P kyber.Point) kyber.Point {
+	for i := 0; i < 3; i++ {
+		P.Add(P, P)
+	}
+	return P
+}
+
+// isSmallOrder returns whether 8·P is the identity.
+func isSmallOrder(P kyber.Point) bool {
+	return mulCofactor(P.Clone()).Equal(group.Point().Null())
 }
 
 func hashSeed(seed []byte) (hash [64]byte) {
@@ -5,12 +5,16 @@ import (
 	"bytes"
 	"compress/gzip"
 	"crypto/cipher"
+	"crypto/sha512"
 	"encoding/hex"
+	"fmt"
 	"os"
 	"strings"
 	"testing"
 
 	"github.com/stretchr/testify/assert"
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/random"
 )
 
 // EdDSATestVectors taken from RFC8032 section 7.1
@@ -95,6 +99,145 @@ func TestEdDSASigning(t *testing.T) {
 	}
 }
 
+func TestBatchVerify(t *testing.T) {
+	const n = 20
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range sigs {
+		ed := NewEdDSA(random.New())
+		publics[i] = ed.Public
+		msgs[i] = []byte(fmt.Sprintf("message %d", i))
+		sig, err := ed.Sign(msgs[i])
+		assert.Nil(t, err)
+		sigs[i] = sig
+	}
+
+	i, err := BatchVerify(publics, msgs, sigs)
+	assert.Nil(t, err)
+	assert.Equal(t, -1, i)
+
+	i, err = BatchVerify(nil, nil, nil)
+	assert.Nil(t, err)
+	assert.Equal(t, -1, i)
+
+	_, err = BatchVerify(publics[1:], msgs, sigs)
+	assert.Error(t, err)
+
+	// Each invalid signature is found, including by its matching Verify error.
+	for _, bad := range []int{0, 7, n - 1} {
+		msgs[bad] = []byte("forged")
+		i, err = BatchVerify(publics, msgs, sigs)
+		assert.Equal(t, bad, i)
+		assert.Equal(t, Verify(publics[bad], msgs[bad], sigs[bad]), err)
+		msgs[bad] = []byte(fmt.Sprintf("message %d", bad))
+	}
+
+	short := sigs[3]
+	sigs[3] = short[:63]
+	i, err = BatchVerify(publics, msgs, sigs)
+	assert.Equal(t, 3, i)
+	assert.Error(t, err)
+	sigs[3] = short
+
+	// VerifyCofactored and BatchVerify accept the same signatures: both check
+	// the cofactored equation, which accepts an R of r·B plus the point T =
+	// (0, -1) of order 2, and both reject an R or a public key of small order.
+	// Verify keeps the cofactorless equation, which does the opposite, or
+	// depends on the parity of the challenge for the public key T.
+	var minusOne [32]byte
+	minusOne[0] = 0xec
+	for j := 1; j < 31; j++ {
+		minusOne[j] = 0xff
+	}
+	minusOne[31] = 0x7f
+	T := group.Point()
+	assert.Nil(t, T.UnmarshalBinary(minusOne[:]))
+
+	// sign returns the signature R || h·a + r on msgs[5] under A.
+	sign := func(R, A kyber.Point, a, r kyber.Scalar) []byte {
+		Rbuff, err := R.MarshalBinary()
+		assert.Nil(t, err)
+		Abuff, err := A.MarshalBinary()
+		assert.Nil(t, err)
+		hash := sha512.New()
+		hash.Write(Rbuff)
+		hash.Write(Abuff)
+		hash.Write(msgs[5])
+		h := group.Scalar().SetBytes(hash.Sum(nil))
+		sBuff, err := h.Mul(h, a).Add(h, r).MarshalBinary()
+		assert.Nil(t, err)
+		return append(Rbuff, sBuff...)
+	}
+	ed := NewEdDSA(random.New())
+	r := group.Scalar().Pick(random.New())
+	zero := group.Scalar().Zero()
+	rB := group.Point().Mul(r, nil)
+	cases := []struct {
+		public kyber.Point
+		sig    []byte
+		valid  bool
+		verify string // what Verify does: "accept", "reject" or either
+	}{
+		{ed.Public, sign(group.Point().Add(rB, T), ed.Public, ed.Secret, r), true, "reject"},
+		{ed.Public, sign(T, ed.Public, ed.Secret, zero), false, "reject"},
+		{ed.Public, sign(group.Point().Null(), ed.Public, ed.Secret, zero), false, "accept"},
+		{T, sign(rB, T, zero, r), false, ""},
+		{group.Point().Null(), sign(rB, group.Point().Null(), zero, r), false, "accept"},
+	}
+	for k, c := range cases {
+		publics[5], sigs[5] = c.public, c.sig
+		switch c.verify {
+		case "accept":
+			assert.Nil(t, Verify(publics[5], msgs[5], sigs[5]), "case %d", k)
+		case "reject":
+			assert.Error(t, Verify(publics[5], msgs[5], sigs[5]), "case %d", k)
+		}
+		err := VerifyCofactored(publics[5], msgs[5], sigs[5])
+		i, batchErr := BatchVerify(publics, msgs, sigs)
+		if c.valid {
+			assert.Nil(t, err, "case %d", k)
+			assert.Nil(t, batchErr, "case %d", k)
+			assert.Equal(t, -1, i, "case %d", k)
+		} else {
+			assert.Error(t, err, "case %d", k)
+			assert.Equal(t, err, batchErr, "case %d", k)
+			assert.Equal(t, 5, i, "case %d", k)
+		}
+	}
+}
+
+func benchmarkVerify(b *testing.B, n int, batch bool) {
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range sigs {
+		ed := NewEdDSA(random.New())
+		publics[i] = ed.Public
+		msgs[i] = []byte(fmt.Sprintf("message %d", i))
+		sigs[i], _ = ed.Sign(msgs[i])
+	}
+
+	b.ResetTimer()
+	for k := 0; k < b.N; k++ {
+		if batch {
+			if _, err := BatchVerify(publics, msgs, sigs); err != nil {
+				b.Fatal(err)
+			}
+			continue
+		}
+		for i := range sigs {
+			if err := Verify(publics[i], msgs[i], sigs[i]); err != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+}
+
+func BenchmarkVerify64(b *testing.B)       { benchmarkVerify(b, 64, false) }
+func BenchmarkBatchVerify64(b *testing.B)  { benchmarkVerify(b, 64, true) }
+func BenchmarkBatchVerify512(b *testing.B) { benchmarkVerify(b, 512, true) }
+
 type constantStream struct {
 	seed []byte
 }
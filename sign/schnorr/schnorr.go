@@ -16,8 +16,11 @@ import (
 	"crypto/sha512"
 	"errors"
 	"fmt"
+	"math/bits"
 
 	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/util/msm"
+	"go.dedis.ch/kyber/v3/util/random"
 )
 
 // Suite represents the set of functionalities needed by the package schnorr.
@@ -60,37 +63,190 @@ func Sign(s Suite, private kyber.Scalar, msg []byte) ([]byte, error) {
 // Verify verifies a given Schnorr signature. It returns nil iff the
 // given signature is valid.
 func Verify(g kyber.Group, public kyber.Point, msg, sig []byte) error {
-	R := g.Point()
-	s := g.Scalar()
+	R, s, h, err := decode(g, public, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	// compute S = g^s
+	S := g.Point().Mul(s, nil)
+	// compute RAh = R + A^h
+	Ah := g.Point().Mul(h, public)
+	RAs := g.Point().Add(R, Ah)
+
+	if !S.Equal(RAs) {
+		return errors.New("schnorr: invalid signature")
+	}
+
+	return nil
+}
+
+// VerifyCofactored is like Verify, but in a group with a cofactor c, see
+// kyber.Cofactored, it checks c·s·B == c·R + c·h·A and rejects an R or a
+// public key of small order. It accepts exactly the signatures that
+// BatchVerify accepts, which include those whose R differs from that of a
+// valid signature by a point of small order; Verify rejects these. In a group
+// of prime order, it is the same as Verify.
+func VerifyCofactored(g kyber.Group, public kyber.Point, msg, sig []byte) error {
+	R, s, h, err := decodeCofactored(g, public, msg, sig)
+	if err != nil {
+		return err
+	}
+
+	// c·(s·B - R - h·A) must be the identity.
+	P := g.Point().Mul(s, nil)
+	P.Sub(P, R)
+	P.Sub(P, g.Point().Mul(h, public))
+	if !mulCofactor(P, cofactor(g)).Equal(g.Point().Null()) {
+		return errors.New("schnorr: invalid signature")
+	}
+
+	return nil
+}
+
+// BatchVerify verifies the signatures sigs[i] on msgs[i] under the public
+// keys publics[i] at once. Each equation s·B == R + h·A is weighted with a
+// random 128-bit scalar z, and c·(Σ z·(R + h·A) - (Σ z·s)·B) is checked to
+// be the identity with one multi-scalar multiplication, where c is the
+// cofactor of g, or 1. An invalid signature makes the check fail except with
+// probability 2^-128. BatchVerify accepts the same signatures as
+// VerifyCofactored, and in a group with a cofactor not quite as Verify: see
+// VerifyCofactored for the difference.
+//
+// BatchVerify returns -1 and nil if all signatures are valid. Otherwise, it
+// finds an invalid signature by checking halves of the failed batch, and
+// returns its index and why it is invalid.
+func BatchVerify(g kyber.Group, publics []kyber.Point, msgs, sigs [][]byte) (int, error) {
+	n := len(sigs)
+	if len(publics) != n || len(msgs) != n {
+		return -1, fmt.Errorf("schnorr: got %d public keys and %d messages for %d signatures",
+			len(publics), len(msgs), n)
+	}
+
+	// The terms of signature i are z·R, (z·h)·A and -(z·s)·B.
+	Rs := make([]kyber.Point, n)
+	zs := make([]kyber.Scalar, n)
+	zhs := make([]kyber.Scalar, n)
+	zss := make([]kyber.Scalar, n)
+	stream := random.New()
+	c := cofactor(g)
+	for i := range sigs {
+		R, s, h, err := decodeCofactored(g, publics[i], msgs[i], sigs[i])
+		if err != nil {
+			return i, err
+		}
+		Rs[i] = R
+		zs[i] = g.Scalar().SetBytes(random.Bits(128, false, stream))
+		zhs[i] = h.Mul(zs[i], h)
+		zss[i] = s.Mul(zs[i], s)
+	}
+
+	check := func(lo, hi int) bool {
+		scalars := make([]kyber.Scalar, 0, 2*(hi-lo)+1)
+		points := make([]kyber.Point, 0, 2*(hi-lo)+1)
+		zsSum := g.Scalar().Zero()
+		for i := lo; i < hi; i++ {
+			scalars = append(scalars, zs[i], zhs[i])
+			points = append(points, Rs[i], publics[i])
+			zsSum.Add(zsSum, zss[i])
+		}
+		scalars = append(scalars, zsSum.Neg(zsSum))
+		points = append(points, nil)
+		P := msm.MultiScalarMul(g, scalars, points)
+		return mulCofactor(P, c).Equal(g.Point().Null())
+	}
+	if check(0, n) {
+		return -1, nil
+	}
+
+	// Bisect the failed batch [lo, hi): if its first half passes, the
+	// second one fails.
+	lo, hi := 0, n
+	for hi-lo > 1 {
+		mid := (lo + hi) / 2
+		if check(lo, mid) {
+			lo = mid
+		} else {
+			hi = mid
+		}
+	}
+	if err := VerifyCofactored(g, publics[lo], msgs[lo], sigs[lo]); err != nil {
+		return lo, err
+	}
+	return lo, errors.New("schnorr: invalid signature")
+}
+
+// decode returns the R and s of sig and the challenge hash(public || R || msg).
+func decode(g kyber.Group, public kyber.Point, msg, sig []byte) (R kyber.Point, s, h kyber.Scalar, err error) {
+	R = g.Point()
+	s = g.Scalar()
 	pointSize := R.MarshalSize()
 	scalarSize := s.MarshalSize()
 	sigSize := scalarSize + pointSize
 	if len(sig) != sigSize {
-		return fmt.Errorf("schnorr: signature of invalid length %d instead of %d", len(sig), sigSize)
+		return nil, nil, nil, fmt.Errorf("schnorr: signature of invalid length %d instead of %d", len(sig), sigSize)
 	}
 	if err := R.UnmarshalBinary(sig[:pointSize]); err != nil {
-		return err
+		return nil, nil, nil, err
 	}
 	if err := s.UnmarshalBinary(sig[pointSize:]); err != nil {
-		return err
+		return nil, nil, nil, err
 	}
 	// recompute hash(public || R || msg)
-	h, err := hash(g, public, R, msg)
+	h, err = hash(g, public, R, msg)
 	if err != nil {
-		return err
+		return nil, nil, nil, err
 	}
+	return R, s, h, nil
+}
 
-	// compute S = g^s
-	S := g.Point().Mul(s, nil)
-	// compute RAh = R + A^h
-	Ah := g.Point().Mul(h, public)
-	RAs := g.Point().Add(R, Ah)
+// decodeCofactored is like decode, but in a group with a cofactor, it rejects
+// an R or a public key of small order, for which the cofactored equation holds
+// regardless of the secret key.
+func decodeCofactored(g kyber.Group, public kyber.Point, msg, sig []byte) (R kyber.Point, s, h kyber.Scalar, err error) {
+	R, s, h, err = decode(g, public, msg, sig)
+	if err != nil {
+		return nil, nil, nil, err
+	}
+	if c := cofactor(g); c > 1 {
+		if isSmallOrder(public, c) {
+			return nil, nil, nil, errors.New("schnorr: public key has small order")
+		}
+		if isSmallOrder(R, c) {
+			return nil, nil, nil, errors.New("schnorr: R has small order")
+		}
+	}
+	return R, s, h, nil
+}
 
-	if !S.Equal(RAs) {
-		return errors.New("schnorr: invalid signature")
+// cofactor returns the cofactor of g if it implements kyber.Cofactored, and 1
+// otherwise.
+func cofactor(g kyber.Group) int64 {
+	if c, ok := g.(kyber.Cofactored); ok {
+		return c.Cofactor()
 	}
+	return 1
+}
 
-	return nil
+// mulCofactor sets p to c·p for the small cofactor c and returns it.
+func mulCofactor(p kyber.Point, c int64) kyber.Point {
+	if c == 1 {
+		return p
+	}
+	q := p.Clone()
+	p.Null()
+	for i := bits.Len64(uint64(c)) - 1; i >= 0; i-- {
+		p.Add(p, p)
+		if c>>uint(i)&1 == 1 {
+			p.Add(p, q)
+		}
+	}
+	return p
+}
+
+// isSmallOrder returns whether c·p is the identity for the cofactor c.
+func isSmallOrder(p kyber.Point, c int64) bool {
+	return mulCofactor(p.Clone(), c).Equal(p.Clone().Null())
 }
 
 func hash(g kyber.Group, public, r kyber.Point, msg []byte) (kyber.Scalar, error) {
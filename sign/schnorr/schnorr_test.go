@@ -1,12 +1,15 @@
 package schnorr
 
 import (
+	"bytes"
+	"fmt"
 	"math/rand"
 	"reflect"
 	"testing"
 	"testing/quick"
 
 	"github.com/stretchr/testify/assert"
+	"go.dedis.ch/kyber/v3"
 	"go.dedis.ch/kyber/v3/group/edwards25519"
 	"go.dedis.ch/kyber/v3/sign/eddsa"
 	"go.dedis.ch/kyber/v3/util/key"
@@ -66,6 +69,92 @@ func TestEdDSACompatibility(t *testing.T) {
 
 }
 
+func TestBatchVerify(t *testing.T) {
+	suite := edwards25519.NewBlakeSHA256Ed25519()
+	const n = 20
+	publics := make([]kyber.Point, n)
+	msgs := make([][]byte, n)
+	sigs := make([][]byte, n)
+	for i := range sigs {
+		kp := key.NewKeyPair(suite)
+		publics[i] = kp.Public
+		msgs[i] = []byte(fmt.Sprintf("message %d", i))
+		sig, err := Sign(suite, kp.Private, msgs[i])
+		assert.NoError(t, err)
+		sigs[i] = sig
+	}
+
+	i, err := BatchVerify(suite, publics, msgs, sigs)
+	assert.NoError(t, err)
+	assert.Equal(t, -1, i)
+
+	_, err = BatchVerify(suite, publics, msgs[1:], sigs)
+	assert.Error(t, err)
+
+	for _, bad := range []int{0, 11, n - 1} {
+		sig := sigs[bad]
+		sigs[bad] = sigs[(bad+1)%n]
+		i, err = BatchVerify(suite, publics, msgs, sigs)
+		assert.Equal(t, bad, i)
+		assert.Error(t, err)
+		sigs[bad] = sig
+	}
+
+	// VerifyCofactored and BatchVerify accept the same signatures in a group
+	// with a cofactor: an R with a component of small order passes both, and
+	// an R or a public key of small order fails both, although their
+	// equations hold. Verify keeps the cofactorless equation, which does the
+	// opposite, or depends on the parity of the challenge for the public key
+	// T.
+	T := suite.Point()
+	assert.NoError(t, T.UnmarshalBinary(append([]byte{0xec}, append(bytes.Repeat([]byte{0xff}, 30), 0x7f)...)))
+	kp := key.NewKeyPair(suite)
+	r := suite.Scalar().Pick(suite.RandomStream())
+	rB := suite.Point().Mul(r, nil)
+	// sign returns the signature R || h·x + r on msgs[3] under X.
+	sign := func(R, X kyber.Point, x kyber.Scalar) []byte {
+		h, err := hash(suite, X, R, msgs[3])
+		assert.NoError(t, err)
+		var b bytes.Buffer
+		_, err = R.MarshalTo(&b)
+		assert.NoError(t, err)
+		_, err = h.Mul(h, x).Add(h, r).MarshalTo(&b)
+		assert.NoError(t, err)
+		return b.Bytes()
+	}
+	zero := suite.Scalar().Zero()
+	cases := []struct {
+		public kyber.Point
+		sig    []byte
+		valid  bool
+		verify string // what Verify does: "accept", "reject" or either
+	}{
+		{kp.Public, sign(suite.Point().Add(rB, T), kp.Public, kp.Private), true, "reject"},
+		{suite.Point().Null(), sign(rB, suite.Point().Null(), zero), false, "accept"},
+		{T, sign(rB, T, zero), false, ""},
+	}
+	for k, c := range cases {
+		publics[3], sigs[3] = c.public, c.sig
+		switch c.verify {
+		case "accept":
+			assert.NoError(t, Verify(suite, publics[3], msgs[3], sigs[3]), "case %d", k)
+		case "reject":
+			assert.Error(t, Verify(suite, publics[3], msgs[3], sigs[3]), "case %d", k)
+		}
+		err := VerifyCofactored(suite, publics[3], msgs[3], sigs[3])
+		i, batchErr := BatchVerify(suite, publics, msgs, sigs)
+		if c.valid {
+			assert.NoError(t, err, "case %d", k)
+			assert.NoError(t, batchErr, "case %d", k)
+			assert.Equal(t, -1, i, "case %d", k)
+		} else {
+			assert.Error(t, err, "case %d", k)
+			assert.Equal(t, err, batchErr, "case %d", k)
+			assert.Equal(t, 3, i, "case %d", k)
+		}
+	}
+}
+
 // Simple random stream using the random instance provided by the testing tool
 type quickstream struct {
 	rand *rand.Rand
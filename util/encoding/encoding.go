@@ -24,13 +24,7 @@ func ReadHexPoint(group kyber.Group, r io.Reader) (kyber.Point, error) {
 
 // WriteHexPoint writes a point in hex representation to w.
 func WriteHexPoint(group kyber.Group, w io.Writer, point kyber.Point) error {
-	buf, err := point.MarshalBinary()
-	if err != nil {
-		return err
-	}
-	out := hex.EncodeToString(buf)
-	_, err = w.Write([]byte(out))
-	return err
+	return writeHex(w, point)
 }
 
 // ReadHexScalar takes a hex-encoded scalar and returns that scalar,
@@ -47,12 +41,30 @@ func ReadHexScalar(group kyber.Group, r io.Reader) (kyber.Scalar, error) {
 
 // WriteHexScalar converts a scalar key to a hex-string
 func WriteHexScalar(group kyber.Group, w io.Writer, scalar kyber.Scalar) error {
-	buf, err := scalar.MarshalBinary()
+	return writeHex(w, scalar)
+}
+
+// writeHex writes m in hex representation to w. If m is a
+// kyber.BinaryAppender, its encoding and the hex output share one buffer.
+func writeHex(w io.Writer, m kyber.Marshaling) error {
+	l := m.MarshalSize()
+	buf := make([]byte, 3*l)
+	var raw []byte
+	var err error
+	if a, ok := m.(kyber.BinaryAppender); ok {
+		raw, err = a.AppendBinary(buf[2*l : 2*l])
+	} else {
+		raw, err = m.MarshalBinary()
+	}
 	if err != nil {
 		return err
 	}
-	out := hex.EncodeToString(buf)
-	_, err = w.Write([]byte(out))
+	if len(raw) != l {
+		// Only the first 2*l bytes of buf are free for the hex output.
+		buf = make([]byte, 2*len(raw))
+	}
+	n := hex.Encode(buf, raw)
+	_, err = w.Write(buf[:n])
 	return err
 }
 
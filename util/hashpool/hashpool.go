@@ -0,0 +1,33 @@
+// Package hashpool recycles the SHA-256 hashes that the suites of kyber
+// return from their Hash method, so that the hashes of challenges and
+// commitments do not each allocate a new state.
+package hashpool
+
+import (
+	"crypto/sha256"
+	"hash"
+	"reflect"
+	"sync"
+)
+
+var (
+	sha256Pool = sync.Pool{New: func() interface{} { return sha256.New() }}
+	sha256Type = reflect.TypeOf(sha256.New())
+)
+
+// SHA256 returns a SHA-256 hash in its initial state, reusing a hash given
+// back to Put if there is any.
+func SHA256() hash.Hash {
+	h := sha256Pool.Get().(hash.Hash)
+	h.Reset()
+	return h
+}
+
+// Put gives back h, which must no longer be used, for SHA256 to reuse. Hashes
+// other than SHA-256 are ignored, including SHA-224, whose state has the same
+// type but keeps its output size across Reset.
+func Put(h hash.Hash) {
+	if reflect.TypeOf(h) == sha256Type && h.Size() == sha256.Size {
+		sha256Pool.Put(h)
+	}
+}
@@ -0,0 +1,29 @@
+package hashpool
+
+import (
+	"crypto/sha256"
+	"crypto/sha512"
+	"testing"
+
+	"github.com/stretchr/testify/require"
+)
+
+func TestSHA256(t *testing.T) {
+	want := sha256.Sum256([]byte("hello"))
+	for i := 0; i < 3; i++ {
+		h := SHA256()
+		h.Write([]byte("hello"))
+		require.Equal(t, want[:], h.Sum(nil))
+		// Give back a hash that is not in its initial state.
+		h.Write([]byte("garbage"))
+		Put(h)
+	}
+	// Other hashes are not pooled.
+	Put(sha512.New())
+	require.Equal(t, sha256.Size, SHA256().Size())
+	// Nor is SHA-224, although its state has the same type as SHA-256's.
+	Put(sha256.New224())
+	for i := 0; i < 3; i++ {
+		require.Equal(t, sha256.Size, SHA256().Size())
+	}
+}
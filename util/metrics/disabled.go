@@ -0,0 +1,7 @@
+// +build !metrics
+
+package metrics
+
+// Enabled reports whether kyber is built with the metrics tag, which turns on
+// the counters of the instrumented operations.
+const Enabled = false
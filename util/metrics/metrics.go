@@ -0,0 +1,118 @@
+// Package metrics counts and times the expensive operations of the groups:
+// scalar multiplications, pairings and their parts, field inversions and
+// hashes to curves. It is off unless kyber is built with the metrics tag:
+//
+//	go build -tags metrics
+//
+// Without the tag, Enabled is false and the instrumented operations compile
+// to what they would be without this package. With it, each operation
+// updates a Counter, whose totals Snapshot returns. They can be published
+// with expvar, for instance, by
+//
+//	expvar.Publish("kyber", expvar.Func(func() interface{} {
+//		return metrics.Snapshot()
+//	}))
+//
+// and a hook set with SetHook sees every timed operation, e.g. to trace it.
+package metrics
+
+import (
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// Counter accumulates the number of calls of an operation and the time they
+// took. Its methods are safe for concurrent use. The instrumented code only
+// calls them if Enabled is true, typically as
+//
+//	if metrics.Enabled {
+//		defer counter.Since(time.Now())
+//	}
+type Counter struct {
+	name  string
+	count uint64
+	nanos uint64
+}
+
+// Stat is the state of a Counter: the number of operations, and the total
+// time spent in those that are timed.
+type Stat struct {
+	Count uint64 `json:"count"`
+	Nanos uint64 `json:"nanos"`
+}
+
+var (
+	mu       sync.Mutex
+	counters = map[string]*Counter{}
+	hook     atomic.Value // of func(string, time.Duration)
+)
+
+// NewCounter returns the counter of the given name, creating it if needed.
+// The name is conventionally the package and the operation, such as
+// "bn256.G1.Mul".
+func NewCounter(name string) *Counter {
+	mu.Lock()
+	defer mu.Unlock()
+	c, ok := counters[name]
+	if !ok {
+		c = &Counter{name: name}
+		counters[name] = c
+	}
+	return c
+}
+
+// Name returns the name of c.
+func (c *Counter) Name() string {
+	return c.name
+}
+
+// Since records one operation that started at start, and calls the hook.
+func (c *Counter) Since(start time.Time) {
+	d := time.Since(start)
+	atomic.AddUint64(&c.count, 1)
+	atomic.AddUint64(&c.nanos, uint64(d))
+	if h, _ := hook.Load().(func(string, time.Duration)); h != nil {
+		h(c.name, d)
+	}
+}
+
+// Add records n untimed operations, such as the iterations of a loop.
+func (c *Counter) Add(n uint64) {
+	atomic.AddUint64(&c.count, n)
+}
+
+// Stat returns the current state of c.
+func (c *Counter) Stat() Stat {
+	return Stat{Count: atomic.LoadUint64(&c.count), Nanos: atomic.LoadUint64(&c.nanos)}
+}
+
+// Snapshot returns the state of every counter, by name. The counters are
+// read one at a time, so operations may complete while it runs.
+func Snapshot() map[string]Stat {
+	mu.Lock()
+	defer mu.Unlock()
+	stats := make(map[string]Stat, len(counters))
+	for name, c := range counters {
+		stats[name] = c.Stat()
+	}
+	return stats
+}
+
+// Reset sets every counter back to zero.
+func Reset() {
+	mu.Lock()
+	defer mu.Unlock()
+	for _, c := range counters {
+		atomic.StoreUint64(&c.count, 0)
+		atomic.StoreUint64(&c.nanos, 0)
+	}
+}
+
+// SetHook sets a function that Since calls with the name of the counter and
+// the duration of every timed operation, or removes it if h is nil. The hook
+// runs on the goroutine of the operation, so it must be fast and safe for
+// concurrent use.
+func SetHook(h func(name string, elapsed time.Duration)) {
+	hook.Store(h)
+}
@@ -0,0 +1,47 @@
+package metrics
+
+import (
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/require"
+)
+
+func TestCounter(t *testing.T) {
+	c := NewCounter("metrics.Test")
+	require.Equal(t, c, NewCounter("metrics.Test"))
+	require.Equal(t, "metrics.Test", c.Name())
+
+	var wg sync.WaitGroup
+	for i := 0; i < 10; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			c.Since(time.Now().Add(-time.Millisecond))
+			c.Add(2)
+		}()
+	}
+	wg.Wait()
+
+	s := Snapshot()["metrics.Test"]
+	require.Equal(t, uint64(30), s.Count)
+	require.True(t, s.Nanos >= uint64(10*time.Millisecond))
+
+	Reset()
+	require.Equal(t, Stat{}, c.Stat())
+}
+
+func TestHook(t *testing.T) {
+	c := NewCounter("metrics.TestHook")
+	var names []string
+	SetHook(func(name string, elapsed time.Duration) {
+		names = append(names, name)
+	})
+	c.Since(time.Now())
+	c.Add(1)
+	SetHook(nil)
+	c.Since(time.Now())
+	require.Equal(t, []string{"metrics.TestHook"}, names)
+	require.Equal(t, uint64(3), c.Stat().Count)
+}
@@ -0,0 +1,30 @@
+// Package msm computes multi-scalar multiplications, that is sums of
+// products of scalars and points, on any kyber.Group.
+package msm
+
+import (
+	"go.dedis.ch/kyber/v3"
+)
+
+// MultiScalarMul returns scalars[0]·points[0] + ... + scalars[n-1]·points[n-1]
+// as a new point of g. A nil point stands for the base point of g, as in
+// Point.Mul. The sum uses the MultiScalarMul method of the points of g if
+// they implement kyber.MultiScalarMultiplier, and one Mul per term otherwise.
+// It may take variable time, so only use it on public scalars and points.
+func MultiScalarMul(g kyber.Group, scalars []kyber.Scalar, points []kyber.Point) kyber.Point {
+	if len(scalars) != len(points) {
+		panic("msm: mismatched number of scalars and points")
+	}
+
+	res := g.Point()
+	if m, ok := res.(kyber.MultiScalarMultiplier); ok {
+		return m.MultiScalarMul(scalars, points)
+	}
+
+	res.Null()
+	t := g.Point()
+	for i := range scalars {
+		res.Add(res, t.Mul(scalars[i], points[i]))
+	}
+	return res
+}
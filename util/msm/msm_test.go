@@ -0,0 +1,38 @@
+package msm
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/require"
+	"go.dedis.ch/kyber/v3"
+	"go.dedis.ch/kyber/v3/group/edwards25519"
+	"go.dedis.ch/kyber/v3/group/nist"
+	"go.dedis.ch/kyber/v3/pairing/bn256"
+)
+
+func TestMultiScalarMul(t *testing.T) {
+	bn := bn256.NewSuite()
+	suites := []kyber.Group{
+		edwards25519.NewBlakeSHA256Ed25519(),
+		nist.NewBlakeSHA256P256(),
+		bn.G1(),
+		bn.G2(),
+	}
+	rand := edwards25519.NewBlakeSHA256Ed25519().RandomStream()
+	for _, g := range suites {
+		for _, n := range []int{0, 1, 10} {
+			scalars := make([]kyber.Scalar, n)
+			points := make([]kyber.Point, n)
+			want := g.Point().Null()
+			for i := range scalars {
+				scalars[i] = g.Scalar().Pick(rand)
+				if i != 1 {
+					points[i] = g.Point().Pick(rand)
+				}
+				want.Add(want, g.Point().Mul(scalars[i], points[i]))
+			}
+			got := MultiScalarMul(g, scalars, points)
+			require.True(t, got.Equal(want), "%s with %d terms", g, n)
+		}
+	}
+}
@@ -48,3 +48,11 @@ type XOFFactory interface {
 	// production use).
 	XOF(seed []byte) XOF
 }
+
+// An XOFPool is an XOFFactory that can reuse the XOFs it returned. Once a
+// caller is done with an XOF of XOF, it may give it back with PutXOF, and must
+// not use it afterwards.
+type XOFPool interface {
+	XOFFactory
+	PutXOF(XOF)
+}
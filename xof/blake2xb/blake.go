@@ -3,6 +3,8 @@
 package blake2xb
 
 import (
+	"sync"
+
 	"go.dedis.ch/kyber/v3"
 	"golang.org/x/crypto/blake2b"
 )
@@ -16,6 +18,10 @@ type xof struct {
 
 // New creates a new XOF using the Blake2b hash.
 func New(seed []byte) kyber.XOF {
+	return &xof{impl: newImpl(seed)}
+}
+
+func newImpl(seed []byte) blake2b.XOF {
 	seed1 := seed
 	var seed2 []byte
 	if len(seed) > blake2b.Size {
@@ -33,7 +39,34 @@ func New(seed []byte) kyber.XOF {
 			panic("blake2b.XOF.Write should not return error: " + err.Error())
 		}
 	}
-	return &xof{impl: b}
+	return b
+}
+
+var pool = sync.Pool{New: func() interface{} { return new(xof) }}
+
+// Get returns an XOF in the state that New(seed) creates, reusing an XOF
+// given back to Put if there is any.
+func Get(seed []byte) kyber.XOF {
+	x := pool.Get().(*xof)
+	x.Reset(seed)
+	return x
+}
+
+// Put gives back x, which must no longer be used, for Get to reuse. XOFs of
+// other packages are ignored.
+func Put(x kyber.XOF) {
+	if x, ok := x.(*xof); ok {
+		pool.Put(x)
+	}
+}
+
+// Reset puts x in the state that New(seed) creates. The key of Blake2b cannot
+// be changed in place, so only the wrapper and its buffer are reused.
+func (x *xof) Reset(seed []byte) {
+	for i := range x.key {
+		x.key[i] = 0
+	}
+	x.impl = newImpl(seed)
 }
 
 func (x *xof) Clone() kyber.XOF {
@@ -49,16 +82,14 @@ func (x *xof) Write(src []byte) (int, error) {
 }
 
 func (x *xof) Reseed() {
-	// Use New to create a new one seeded with output from the old one.
+	// Create a new implementation seeded with output from the old one.
 	if len(x.key) < 128 {
 		x.key = make([]byte, 128)
 	} else {
 		x.key = x.key[0:128]
 	}
 	x.Read(x.key)
-	y := New(x.key)
-	// Steal the XOF implementation, and put it inside of x.
-	x.impl = y.(*xof).impl
+	x.impl = newImpl(x.key)
 }
 
 func (x *xof) XORKeyStream(dst, src []byte) {
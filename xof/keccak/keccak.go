@@ -3,6 +3,8 @@
 package keccak
 
 import (
+	"sync"
+
 	"go.dedis.ch/kyber/v3"
 	"golang.org/x/crypto/sha3"
 )
@@ -21,6 +23,33 @@ func New(seed []byte) kyber.XOF {
 	return &xof{sh: sh}
 }
 
+var pool = sync.Pool{New: func() interface{} { return &xof{sh: sha3.NewShake256()} }}
+
+// Get returns an XOF in the state that New(seed) creates, reusing an XOF
+// given back to Put if there is any.
+func Get(seed []byte) kyber.XOF {
+	x := pool.Get().(*xof)
+	x.Reset(seed)
+	return x
+}
+
+// Put gives back x, which must no longer be used, for Get to reuse. XOFs of
+// other packages are ignored.
+func Put(x kyber.XOF) {
+	if x, ok := x.(*xof); ok {
+		pool.Put(x)
+	}
+}
+
+// Reset puts x in the state that New(seed) creates, without allocating.
+func (x *xof) Reset(seed []byte) {
+	for i := range x.key {
+		x.key[i] = 0
+	}
+	x.sh.Reset()
+	x.sh.Write(seed)
+}
+
 func (x *xof) Clone() kyber.XOF {
 	return &xof{sh: x.sh.Clone()}
 }
@@ -32,7 +61,7 @@ func (x *xof) Reseed() {
 		x.key = x.key[0:128]
 	}
 	x.Read(x.key)
-	x.sh = sha3.NewShake256()
+	x.sh.Reset()
 	x.sh.Write(x.key)
 }
 
@@ -237,3 +237,35 @@ func testEncDecMismatch(t *testing.T, s kyber.XOFFactory) {
 		t.Fatal("wrong decode")
 	}
 }
+
+func TestGetPut(t *testing.T) {
+	pools := []struct {
+		get func([]byte) kyber.XOF
+		put func(kyber.XOF)
+		new func([]byte) kyber.XOF
+	}{
+		{blake2xb.Get, blake2xb.Put, blake2xb.New},
+		{keccak.Get, keccak.Put, keccak.New},
+	}
+	// The seeds are shorter and longer than a key of Blake2b.
+	seeds := [][]byte{nil, []byte("seed"), bytes.Repeat([]byte("long seed "), 20)}
+	for _, p := range pools {
+		for _, seed := range seeds {
+			want := make([]byte, 200)
+			p.new(seed).Read(want)
+			for i := 0; i < 3; i++ {
+				x := p.get(seed)
+				got := make([]byte, len(want))
+				x.XORKeyStream(got, got)
+				require.Equal(t, want, got)
+				// Give back an XOF that was read, reseeded and written to.
+				x.Reseed()
+				x.Write([]byte("garbage"))
+				p.put(x)
+			}
+		}
+		// XOFs of the other package are ignored.
+		p.put(pools[0].new(nil))
+		p.put(pools[1].new(nil))
+	}
+}